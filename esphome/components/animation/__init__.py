@@ -103,3 +103,4 @@ async def to_code(config):
         end = loop_config.get(CONF_END_FRAME, frame_count)
         count = loop_config.get(CONF_REPEAT, -1)
         cg.add(var.set_loop(start, end, count))
+    await espImage.run_mask_to_code(var, config)
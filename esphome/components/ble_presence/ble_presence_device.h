@@ -16,6 +16,7 @@ class BLEPresenceDevice : public binary_sensor::BinarySensorInitiallyOff,
   void set_address(uint64_t address) {
     this->match_by_ = MATCH_BY_MAC_ADDRESS;
     this->address_ = address;
+    this->add_address_filter(address);
   }
   void set_irk(uint8_t *irk) {
     this->match_by_ = MATCH_BY_IRK;
@@ -24,18 +25,23 @@ class BLEPresenceDevice : public binary_sensor::BinarySensorInitiallyOff,
   void set_service_uuid16(uint16_t uuid) {
     this->match_by_ = MATCH_BY_SERVICE_UUID;
     this->uuid_ = esp32_ble_tracker::ESPBTUUID::from_uint16(uuid);
+    this->add_service_uuid_filter(this->uuid_);
   }
   void set_service_uuid32(uint32_t uuid) {
     this->match_by_ = MATCH_BY_SERVICE_UUID;
     this->uuid_ = esp32_ble_tracker::ESPBTUUID::from_uint32(uuid);
+    this->add_service_uuid_filter(this->uuid_);
   }
   void set_service_uuid128(uint8_t *uuid) {
     this->match_by_ = MATCH_BY_SERVICE_UUID;
     this->uuid_ = esp32_ble_tracker::ESPBTUUID::from_raw(uuid);
+    this->add_service_uuid_filter(this->uuid_);
   }
   void set_ibeacon_uuid(uint8_t *uuid) {
     this->match_by_ = MATCH_BY_IBEACON_UUID;
     this->ibeacon_uuid_ = esp32_ble_tracker::ESPBTUUID::from_raw(uuid);
+    // iBeacons are sent as Apple manufacturer data
+    this->add_manufacturer_uuid_filter(esp32_ble_tracker::ESPBTUUID::from_uint16(0x004C));
   }
   void set_ibeacon_major(uint16_t major) {
     this->check_ibeacon_major_ = true;
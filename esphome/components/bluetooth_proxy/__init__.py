@@ -10,6 +10,10 @@ CODEOWNERS = ["@jesserockz"]
 
 CONF_CACHE_SERVICES = "cache_services"
 CONF_CONNECTIONS = "connections"
+CONF_ADVERTISEMENT_DEDUP = "advertisement_dedup"
+CONF_RSSI_THRESHOLD = "rssi_threshold"
+CONF_CACHE_SIZE = "cache_size"
+CONF_WINDOW = "window"
 MAX_CONNECTIONS = 3
 
 bluetooth_proxy_ns = cg.esphome_ns.namespace("bluetooth_proxy")
@@ -52,6 +56,19 @@ CONFIG_SCHEMA = cv.All(
             cv.SplitDefault(CONF_CACHE_SERVICES, esp32_idf=True): cv.All(
                 cv.only_with_esp_idf, cv.boolean
             ),
+            cv.Optional(CONF_ADVERTISEMENT_DEDUP): cv.Schema(
+                {
+                    cv.Optional(
+                        CONF_WINDOW, default="10s"
+                    ): cv.positive_time_period_milliseconds,
+                    cv.Optional(CONF_RSSI_THRESHOLD, default=5): cv.int_range(
+                        min=1, max=100
+                    ),
+                    cv.Optional(CONF_CACHE_SIZE, default=32): cv.int_range(
+                        min=1, max=255
+                    ),
+                }
+            ),
             cv.Optional(CONF_CONNECTIONS): cv.All(
                 cv.ensure_list(CONNECTION_SCHEMA),
                 cv.Length(min=1, max=MAX_CONNECTIONS),
@@ -69,6 +86,14 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     cg.add(var.set_active(config[CONF_ACTIVE]))
+    if dedup_config := config.get(CONF_ADVERTISEMENT_DEDUP):
+        cg.add(
+            var.set_advertisement_dedup(
+                dedup_config[CONF_WINDOW],
+                dedup_config[CONF_RSSI_THRESHOLD],
+                dedup_config[CONF_CACHE_SIZE],
+            )
+        )
     await esp32_ble_tracker.register_ble_device(var, config)
 
     for connection_conf in config.get(CONF_CONNECTIONS, []):
@@ -3,6 +3,9 @@
 #include "esphome/core/log.h"
 #include "esphome/core/macros.h"
 
+#include <cinttypes>
+#include <cstdlib>
+
 #ifdef USE_ESP32
 
 namespace esphome {
@@ -40,14 +43,19 @@ bool BluetoothProxy::parse_devices(esp_ble_gap_cb_param_t::ble_scan_result_evt_p
     return false;
 
   api::BluetoothLERawAdvertisementsResponse resp;
+  const uint32_t now = millis();
   for (size_t i = 0; i < count; i++) {
     auto &result = advertisements[i];
+    uint64_t address = esp32_ble::ble_addr_to_uint64(result.bda);
+    uint8_t length = result.adv_data_len + result.scan_rsp_len;
+    if (!this->dedup_cache_.empty() && !this->should_forward_(result, address, length, now))
+      continue;
+
     api::BluetoothLERawAdvertisement adv;
-    adv.address = esp32_ble::ble_addr_to_uint64(result.bda);
+    adv.address = address;
     adv.rssi = result.rssi;
     adv.address_type = result.ble_addr_type;
 
-    uint8_t length = result.adv_data_len + result.scan_rsp_len;
     adv.data.reserve(length);
     for (uint16_t i = 0; i < length; i++) {
       adv.data.push_back(result.ble_adv[i]);
@@ -58,10 +66,47 @@ bool BluetoothProxy::parse_devices(esp_ble_gap_cb_param_t::ble_scan_result_evt_p
     ESP_LOGV(TAG, "Proxying raw packet from %02X:%02X:%02X:%02X:%02X:%02X, length %d. RSSI: %d dB", result.bda[0],
              result.bda[1], result.bda[2], result.bda[3], result.bda[4], result.bda[5], length, result.rssi);
   }
-  ESP_LOGV(TAG, "Proxying %d packets", count);
+  if (resp.advertisements.empty())
+    return true;
+  ESP_LOGV(TAG, "Proxying %d packets", resp.advertisements.size());
   this->api_connection_->send_bluetooth_le_raw_advertisements_response(resp);
   return true;
 }
+
+bool BluetoothProxy::should_forward_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &result,
+                                     uint64_t address, uint8_t length, uint32_t now) {
+  // FNV-1a over the advertisement and scan response payload
+  uint32_t hash = 2166136261UL;
+  for (uint8_t i = 0; i < length; i++) {
+    hash ^= result.ble_adv[i];
+    hash *= 16777619UL;
+  }
+
+  // Keyed by address and payload, so the advertisement and scan response of a device use separate entries
+  DedupEntry *victim = &this->dedup_cache_[0];
+  for (auto &entry : this->dedup_cache_) {
+    if (entry.used && entry.address == address && entry.data_hash == hash) {
+      entry.last_seen = now;
+      if (now - entry.last_sent < this->dedup_window_ && abs(result.rssi - entry.rssi) < this->dedup_rssi_threshold_)
+        return false;
+      entry.rssi = result.rssi;
+      entry.last_sent = now;
+      return true;
+    }
+    // Prefer a free slot, otherwise evict the entry seen least recently
+    if (victim->used && (!entry.used || now - entry.last_seen > now - victim->last_seen))
+      victim = &entry;
+  }
+
+  *victim = DedupEntry{address, hash, now, now, result.rssi, true};
+  return true;
+}
+
+void BluetoothProxy::clear_advertisement_dedup_() {
+  for (auto &entry : this->dedup_cache_)
+    entry.used = false;
+}
+
 void BluetoothProxy::send_api_packet_(const esp32_ble_tracker::ESPBTDevice &device) {
   api::BluetoothLEAdvertisementResponse resp;
   resp.address = device.address_uint64();
@@ -92,6 +137,12 @@ void BluetoothProxy::dump_config() {
   ESP_LOGCONFIG(TAG, "  Active: %s", YESNO(this->active_));
   ESP_LOGCONFIG(TAG, "  Connections: %d", this->connections_.size());
   ESP_LOGCONFIG(TAG, "  Raw advertisements: %s", YESNO(this->raw_advertisements_));
+  if (!this->dedup_cache_.empty()) {
+    ESP_LOGCONFIG(TAG, "  Advertisement deduplication:");
+    ESP_LOGCONFIG(TAG, "    Window: %" PRIu32 " ms", this->dedup_window_);
+    ESP_LOGCONFIG(TAG, "    RSSI threshold: %u dB", this->dedup_rssi_threshold_);
+    ESP_LOGCONFIG(TAG, "    Cache size: %zu", this->dedup_cache_.size());
+  }
 }
 
 int BluetoothProxy::get_bluetooth_connections_free() {
@@ -446,6 +497,8 @@ void BluetoothProxy::subscribe_api_connection(api::APIConnection *api_connection
   }
   this->api_connection_ = api_connection;
   this->raw_advertisements_ = flags & BluetoothProxySubscriptionFlag::SUBSCRIPTION_RAW_ADVERTISEMENTS;
+  // A new client has not seen any advertisement yet
+  this->clear_advertisement_dedup_();
   this->parent_->recalculate_advertisement_parser_types();
 }
 
@@ -456,6 +509,7 @@ void BluetoothProxy::unsubscribe_api_connection(api::APIConnection *api_connecti
   }
   this->api_connection_ = nullptr;
   this->raw_advertisements_ = false;
+  this->clear_advertisement_dedup_();
   this->parent_->recalculate_advertisement_parser_types();
 }
 
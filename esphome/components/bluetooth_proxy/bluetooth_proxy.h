@@ -95,6 +95,13 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
 
   void set_active(bool active) { this->active_ = active; }
   bool has_active() { return this->active_; }
+  /// Suppress raw advertisements identical to one already forwarded for the same address within window_ms,
+  /// unless the RSSI moved by at least rssi_threshold dB. Up to cache_size payloads are tracked.
+  void set_advertisement_dedup(uint32_t window_ms, uint8_t rssi_threshold, uint8_t cache_size) {
+    this->dedup_window_ = window_ms;
+    this->dedup_rssi_threshold_ = rssi_threshold;
+    this->dedup_cache_.resize(cache_size);
+  }
 
   uint32_t get_legacy_version() const {
     if (this->active_) {
@@ -123,7 +130,19 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   }
 
  protected:
+  struct DedupEntry {
+    uint64_t address;
+    uint32_t data_hash;
+    uint32_t last_sent;
+    uint32_t last_seen;
+    int8_t rssi;
+    bool used;
+  };
+
   void send_api_packet_(const esp32_ble_tracker::ESPBTDevice &device);
+  bool should_forward_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &result, uint64_t address,
+                       uint8_t length, uint32_t now);
+  void clear_advertisement_dedup_();
 
   BluetoothConnection *get_connection_(uint64_t address, bool reserve);
 
@@ -132,6 +151,11 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   std::vector<BluetoothConnection *> connections_{};
   api::APIConnection *api_connection_{nullptr};
   bool raw_advertisements_{false};
+
+  /// Small LRU of recently forwarded advertisements, empty when deduplication is disabled.
+  std::vector<DedupEntry> dedup_cache_{};
+  uint32_t dedup_window_{0};
+  uint8_t dedup_rssi_threshold_{0};
 };
 
 extern BluetoothProxy *global_bluetooth_proxy;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -22,6 +22,7 @@ class CST226Touchscreen : public touchscreen::Touchscreen, public i2c::I2CDevice
   void set_interrupt_pin(InternalGPIOPin *pin) { this->interrupt_pin_ = pin; }
   void set_reset_pin(GPIOPin *pin) { this->reset_pin_ = pin; }
   bool can_proceed() override { return this->setup_complete_ || this->is_failed(); }
+  bool is_setup_barrier() const override { return false; }
 
  protected:
   bool read16_(uint16_t addr, uint8_t *data, size_t len) {
@@ -0,0 +1,69 @@
+#include "dirty_regions.h"
+
+#include <algorithm>
+
+namespace esphome {
+namespace display {
+
+static inline int32_t area(const Rect &rect) { return int32_t(rect.w) * rect.h; }
+
+int32_t DirtyRegions::merge_cost_(const Rect &a, const Rect &b) {
+  Rect merged = a;
+  merged.extend(b);
+  int32_t overlap_w = std::min(a.x2(), b.x2()) - std::max(a.x, b.x);
+  int32_t overlap_h = std::min(a.y2(), b.y2()) - std::max(a.y, b.y);
+  int32_t overlap = (overlap_w > 0 && overlap_h > 0) ? overlap_w * overlap_h : 0;
+  return area(merged) - area(a) - area(b) + overlap;
+}
+
+void DirtyRegions::merge_(uint8_t into, uint8_t from) {
+  this->regions_[into].extend(this->regions_[from]);
+  this->count_--;
+  if (from != this->count_)
+    this->regions_[from] = this->regions_[this->count_];
+  if (into == this->count_)
+    into = from;
+  this->last_ = into;
+}
+
+void HOT DirtyRegions::add(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (w <= 0 || h <= 0)
+    return;
+  // consecutive writes usually hit the region touched last
+  if (this->count_ != 0) {
+    const Rect &last = this->regions_[this->last_];
+    if (x >= last.x && y >= last.y && x + w <= last.x2() && y + h <= last.y2())
+      return;
+  }
+
+  Rect rect(x, y, w, h);
+  uint8_t best = 0;
+  int32_t best_cost = INT32_MAX;
+  for (uint8_t i = 0; i != this->count_; i++) {
+    int32_t cost = merge_cost_(this->regions_[i], rect);
+    if (cost < best_cost) {
+      best = i;
+      best_cost = cost;
+    }
+  }
+  if (best_cost > int32_t(this->merge_slack_) && this->count_ != MAX_REGIONS) {
+    this->last_ = this->count_;
+    this->regions_[this->count_++] = rect;
+    return;
+  }
+
+  this->regions_[best].extend(rect);
+  this->last_ = best;
+  // the grown region may now be close enough to others to merge them as well
+  for (uint8_t i = 0; i < this->count_;) {
+    if (i != this->last_ && merge_cost_(this->regions_[this->last_], this->regions_[i]) <= int32_t(this->merge_slack_)) {
+      this->merge_(this->last_, i);
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+}
+
+}  // namespace display
+}  // namespace esphome
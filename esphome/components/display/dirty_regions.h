@@ -0,0 +1,46 @@
+#pragma once
+
+#include "rect.h"
+
+namespace esphome {
+namespace display {
+
+/** Tracks the changed areas of a display buffer as a short list of rectangles.
+ *
+ * Changes close to each other are merged into one region as long as the merged rectangle does not cover more
+ * unchanged pixels than the merge slack, which should roughly match what it costs a driver to start another
+ * transfer. Drivers can then send every region with its own address window instead of one bounding box around
+ * all changes.
+ */
+class DirtyRegions {
+ public:
+  static const uint8_t MAX_REGIONS = 4;
+
+  /// Mark the rectangle with the top left point at [x,y] as changed.
+  void add(int16_t x, int16_t y, int16_t w, int16_t h);
+  /// Mark a single pixel as changed.
+  void add(int16_t x, int16_t y) { this->add(x, y, 1, 1); }
+
+  void clear() { this->count_ = 0; }
+  bool empty() const { return this->count_ == 0; }
+  uint8_t size() const { return this->count_; }
+  const Rect *begin() const { return this->regions_; }
+  const Rect *end() const { return this->regions_ + this->count_; }
+
+  /// Set how many unchanged pixels a merge of two regions may add before they are kept apart.
+  void set_merge_slack(uint32_t merge_slack) { this->merge_slack_ = merge_slack; }
+
+ protected:
+  /// Number of unchanged pixels covered when merging a and b into their bounding box.
+  static int32_t merge_cost_(const Rect &a, const Rect &b);
+  /// Merge region from into region into and remove region from.
+  void merge_(uint8_t into, uint8_t from);
+
+  Rect regions_[MAX_REGIONS];
+  uint8_t count_{0};
+  uint8_t last_{0};
+  uint32_t merge_slack_{256};
+};
+
+}  // namespace display
+}  // namespace esphome
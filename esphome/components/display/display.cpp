@@ -85,16 +85,48 @@ void Display::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8
   }
 }
 
-void HOT Display::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = x; i < x + width; i++)
-    this->draw_pixel_at(i, y, color);
+void Display::draw_alpha_bitmap_at(int x, int y, int width, int height, const uint8_t *data, uint8_t bpp,
+                                   Color color, Color background) {
+  decode_alpha_bitmap_(x, y, width, height, data, bpp, [&](int run_x, int run_y, int length, uint8_t pixel) {
+    const Color run_color = blend_alpha_(pixel, bpp, color, background);
+    if (length == 1) {
+      this->draw_pixel_at(run_x, run_y, run_color);
+    } else {
+      this->fill_span(run_x, run_y, length, run_color);
+    }
+  });
+}
+void HOT Display::draw_rgb565_at(int x, int y, int width, int height, const uint8_t *data, size_t stride) {
+  for (int j = 0; j != height; j++, data += stride) {
+    for (int i = 0; i != width; i++)
+      this->draw_pixel_at(x + i, y + j, rgb565_to_color_(data + i * 2));
+  }
 }
-void HOT Display::vertical_line(int x, int y, int height, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = y; i < y + height; i++)
-    this->draw_pixel_at(x, i, color);
+Color Display::rgb565_to_color_(const uint8_t *data) {
+  const uint16_t rgb565 = encode_uint16(progmem_read_byte(data), progmem_read_byte(data + 1));
+  const uint8_t r = (rgb565 >> 11) & 0x1F;
+  const uint8_t g = (rgb565 >> 5) & 0x3F;
+  const uint8_t b = rgb565 & 0x1F;
+  return Color((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), 0xFF);
+}
+Color Display::blend_alpha_(uint8_t pixel, uint8_t bpp, Color color, Color background) {
+  const uint8_t bpp_max = (1 << bpp) - 1;
+  if (pixel == bpp_max)
+    return color;
+  auto on = (float) pixel / (float) bpp_max;
+  return Color((uint8_t) (((float) color.r - (float) background.r) * on + (float) background.r),
+               (uint8_t) (((float) color.g - (float) background.g) * on + (float) background.g),
+               (uint8_t) (((float) color.b - (float) background.b) * on + (float) background.b),
+               (uint8_t) (((float) color.w - (float) background.w) * on + (float) background.w));
+}
+void HOT Display::fill_rect(int x, int y, int width, int height, Color color) {
+  for (int j = y; j < y + height; j++) {
+    for (int i = x; i < x + width; i++)
+      this->draw_pixel_at(i, j, color);
+  }
 }
+void HOT Display::horizontal_line(int x, int y, int width, Color color) { this->fill_span(x, y, width, color); }
+void HOT Display::vertical_line(int x, int y, int height, Color color) { this->fill_rect(x, y, 1, height, color); }
 void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->horizontal_line(x1, y1, width, color);
   this->horizontal_line(x1, y1 + height - 1, width, color);
@@ -102,10 +134,7 @@ void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
 void Display::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
-  for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
-  }
+  this->fill_rect(x1, y1, width, height, color);
 }
 void HOT Display::circle(int center_x, int center_xy, int radius, Color color) {
   int dx = -radius;
@@ -6,6 +6,7 @@
 #include "rect.h"
 
 #include "esphome/core/color.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/automation.h"
 #include "esphome/core/time.h"
 #include "esphome/core/log.h"
@@ -256,6 +257,34 @@ class Display : public PollingComponent {
     this->draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, 0, 0, 0);
   }
 
+  /** Fill a rectangle with the top left point at [x,y] with the given color.
+   * All filled shapes and straight horizontal/vertical lines are drawn with this. The naive implementation here
+   * draws every pixel, but it can be overridden by sub-classes in order to write whole rows at once.
+   */
+  virtual void fill_rect(int x, int y, int width, int height, Color color);
+
+  /// Fill a horizontal span from the point [x,y] to [x+width,y] with the given color.
+  void fill_span(int x, int y, int width, Color color) { this->fill_rect(x, y, width, 1, color); }
+
+  /** Draw a bitmap of alpha values, as used for font glyphs, with the top left point at [x,y].
+   * The pixels are packed MSB first with bpp (1, 2, 4 or 8) bits each and rows are not padded. Pixels with value 0
+   * are left untouched, the maximum value draws color and the values in between blend color with background.
+   * The data may be stored in PROGMEM.
+   * The implementation here draws each horizontal run of equal pixels with fill_span(), but it can be overridden by
+   * sub-classes in order to optimise the procedure.
+   */
+  virtual void draw_alpha_bitmap_at(int x, int y, int width, int height, const uint8_t *data, uint8_t bpp,
+                                    Color color, Color background);
+
+  /** Draw a block of big-endian RGB565 pixels, as stored for RGB565 images, with the top left point at [x,y].
+   * Unlike draw_pixels_at() this always goes through the clipping and rotation of draw_pixel_at(), so it can be mixed
+   * freely with other drawing calls. The data may be stored in PROGMEM and stride is the distance in bytes between
+   * the starts of two rows.
+   * The implementation here converts and draws every pixel, but it can be overridden by sub-classes whose buffer
+   * holds the same format in order to copy whole rows.
+   */
+  virtual void draw_rgb565_at(int x, int y, int width, int height, const uint8_t *data, size_t stride);
+
   /// Draw a straight line from the point [x1,y1] to [x2,y2] with the given color.
   void line(int x1, int y1, int x2, int y2, Color color = COLOR_ON);
 
@@ -657,6 +686,42 @@ class Display : public PollingComponent {
   void show_test_card() { this->show_test_card_ = true; }
 
  protected:
+  /// Read a big-endian RGB565 pixel, possibly from PROGMEM, and expand it to a color.
+  static Color rgb565_to_color_(const uint8_t *data);
+
+  /// The color drawn for an alpha bitmap pixel with value pixel, see draw_alpha_bitmap_at().
+  static Color blend_alpha_(uint8_t pixel, uint8_t bpp, Color color, Color background);
+
+  /** Decode an alpha bitmap as described for draw_alpha_bitmap_at() and call run(x, y, length, pixel) for every
+   * horizontal run of equal, non-transparent pixels. Use blend_alpha_() to get the color of a pixel value.
+   */
+  template<typename F>
+  static void decode_alpha_bitmap_(int x, int y, int width, int height, const uint8_t *data, uint8_t bpp, F &&run) {
+    const uint8_t bpp_max = (1 << bpp) - 1;
+    uint8_t pixel_data = 0;
+    uint8_t shift = 0;
+    for (int row = y; row != y + height; row++) {
+      int run_start = 0;
+      uint8_t run_pixel = 0;
+      for (int col = 0; col != width; col++) {
+        if (shift == 0) {
+          pixel_data = progmem_read_byte(data++);
+          shift = 8;
+        }
+        shift -= bpp;
+        const uint8_t pixel = (pixel_data >> shift) & bpp_max;
+        if (pixel != run_pixel) {
+          if (run_pixel != 0)
+            run(x + run_start, row, col - run_start, run_pixel);
+          run_start = col;
+          run_pixel = pixel;
+        }
+      }
+      if (run_pixel != 0)
+        run(x + run_start, row, width - run_start, run_pixel);
+    }
+  }
+
   bool clamp_x_(int x, int w, int &min_x, int &max_x);
   bool clamp_y_(int y, int h, int &min_y, int &max_y);
   void vprintf_(int x, int y, BaseFont *font, Color color, Color background, TextAlign align, const char *format,
@@ -1,5 +1,6 @@
 #include "display_buffer.h"
 
+#include <cstring>
 #include <utility>
 
 #include "esphome/core/application.h"
@@ -20,6 +21,44 @@ void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   this->clear();
 }
 
+void DisplayBuffer::diff_buffer_rows_(size_t rows, size_t row_length,
+                                      const std::function<void(size_t row, size_t start, size_t length)> &changed) {
+  if (this->buffer_ == nullptr)
+    return;
+  const size_t length = rows * row_length;
+  if (this->shadow_buffer_ == nullptr) {
+    ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+    this->shadow_buffer_ = allocator.allocate(length);
+    if (this->shadow_buffer_ == nullptr) {
+      // Without a copy we can only send everything, every time
+      for (size_t row = 0; row < rows; row++)
+        changed(row, 0, row_length);
+      return;
+    }
+    this->shadow_valid_ = false;
+  }
+
+  for (size_t row = 0; row < rows; row++) {
+    const uint8_t *data = this->buffer_ + row * row_length;
+    uint8_t *shadow = this->shadow_buffer_ + row * row_length;
+    if (!this->shadow_valid_) {
+      changed(row, 0, row_length);
+      continue;
+    }
+    size_t start = 0;
+    while (start < row_length && data[start] == shadow[start])
+      start++;
+    if (start == row_length)
+      continue;
+    size_t end = row_length;
+    while (data[end - 1] == shadow[end - 1])
+      end--;
+    changed(row, start, end - start);
+  }
+  memcpy(this->shadow_buffer_, this->buffer_, length);
+  this->shadow_valid_ = true;
+}
+
 int DisplayBuffer::get_width() {
   switch (this->rotation_) {
     case DISPLAY_ROTATION_90_DEGREES:
@@ -68,5 +107,133 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
   App.feed_wdt();
 }
 
+bool DisplayBuffer::clip_rect_(int &min_x, int &min_y, int &max_x, int &max_y) {
+  min_x = std::max(min_x, 0);
+  max_x = std::min(max_x, this->get_width());
+  min_y = std::max(min_y, 0);
+  max_y = std::min(max_y, this->get_height());
+  Rect clipping = this->get_clipping();
+  if (clipping.is_set()) {
+    // same bounds as the Rect::inside() check in draw_pixel_at(), which includes the right and bottom edge
+    min_x = std::max(min_x, (int) clipping.x);
+    max_x = std::min(max_x, clipping.x2() + 1);
+    min_y = std::max(min_y, (int) clipping.y);
+    max_y = std::min(max_y, clipping.y2() + 1);
+  }
+  return min_x < max_x && min_y < max_y;
+}
+
+void HOT DisplayBuffer::fill_rect(int x, int y, int width, int height, Color color) {
+  int min_x = x;
+  int min_y = y;
+  int max_x = x + width;
+  int max_y = y + height;
+  if (!this->clip_rect_(min_x, min_y, max_x, max_y))
+    return;
+  width = max_x - min_x;
+  height = max_y - min_y;
+
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      this->fill_absolute_rect_internal(min_x, min_y, width, height, color);
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      this->fill_absolute_rect_internal(this->get_width_internal() - max_y, min_x, height, width, color);
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      this->fill_absolute_rect_internal(this->get_width_internal() - max_x, this->get_height_internal() - max_y, width,
+                                        height, color);
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      this->fill_absolute_rect_internal(min_y, this->get_height_internal() - max_x, height, width, color);
+      break;
+  }
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::draw_rgb565_at(int x, int y, int width, int height, const uint8_t *data, size_t stride) {
+  if (this->rotation_ != DISPLAY_ROTATION_0_DEGREES) {
+    Display::draw_rgb565_at(x, y, width, height, data, stride);
+    return;
+  }
+  int min_x = x;
+  int min_y = y;
+  int max_x = x + width;
+  int max_y = y + height;
+  if (!this->clip_rect_(min_x, min_y, max_x, max_y))
+    return;
+  data += (min_y - y) * stride + (min_x - x) * 2;
+  this->draw_absolute_rgb565_internal(min_x, min_y, max_x - min_x, max_y - min_y, data, stride);
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::draw_absolute_rgb565_internal(int x, int y, int width, int height, const uint8_t *data,
+                                                      size_t stride) {
+  for (int j = 0; j != height; j++, data += stride) {
+    for (int i = 0; i != width; i++)
+      this->draw_absolute_pixel_internal(x + i, y + j, rgb565_to_color_(data + i * 2));
+  }
+}
+
+void HOT DisplayBuffer::draw_alpha_bitmap_at(int x, int y, int width, int height, const uint8_t *data, uint8_t bpp,
+                                             Color color, Color background) {
+  if (this->rotation_ != DISPLAY_ROTATION_0_DEGREES) {
+    Display::draw_alpha_bitmap_at(x, y, width, height, data, bpp, color, background);
+    return;
+  }
+  int min_x = x;
+  int min_y = y;
+  int max_x = x + width;
+  int max_y = y + height;
+  if (!this->clip_rect_(min_x, min_y, max_x, max_y))
+    return;
+  if (min_x != x || min_y != y || max_x != x + width || max_y != y + height) {
+    // the rows of the bitmap are not padded, so a partly hidden one is left to the clipped runs of the default
+    Display::draw_alpha_bitmap_at(x, y, width, height, data, bpp, color, background);
+    return;
+  }
+  this->draw_absolute_alpha_bitmap_internal(x, y, width, height, data, bpp, color, background);
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::draw_absolute_alpha_bitmap_internal(int x, int y, int width, int height, const uint8_t *data,
+                                                            uint8_t bpp, Color color, Color background) {
+  decode_alpha_bitmap_(x, y, width, height, data, bpp, [&](int run_x, int run_y, int length, uint8_t pixel) {
+    const Color run_color = blend_alpha_(pixel, bpp, color, background);
+    if (length == 1) {
+      this->draw_absolute_pixel_internal(run_x, run_y, run_color);
+    } else {
+      this->fill_absolute_rect_internal(run_x, run_y, length, 1, run_color);
+    }
+  });
+}
+
+bool HOT DisplayBuffer::copy_row_(uint8_t *dst, const uint8_t *data, size_t length) {
+#ifdef USE_ESP8266
+  // flash can only be read with aligned words here, so no memcpy()
+  bool changed = false;
+  for (size_t i = 0; i != length; i++) {
+    const uint8_t value = progmem_read_byte(data + i);
+    if (dst[i] != value) {
+      dst[i] = value;
+      changed = true;
+    }
+  }
+  return changed;
+#else
+  if (memcmp(dst, data, length) == 0)
+    return false;
+  memcpy(dst, data, length);
+  return true;
+#endif
+}
+
+void HOT DisplayBuffer::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  for (int j = y; j < y + height; j++) {
+    for (int i = x; i < x + width; i++)
+      this->draw_absolute_pixel_internal(i, j, color);
+  }
+}
+
 }  // namespace display
 }  // namespace esphome
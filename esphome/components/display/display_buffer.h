@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdarg>
+#include <functional>
 #include <vector>
 
 #include "display.h"
@@ -22,12 +23,64 @@ class DisplayBuffer : public Display {
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
 
+  /// Fill a rectangle, clipped and converted to absolute coordinates once for the whole area.
+  void fill_rect(int x, int y, int width, int height, Color color) override;
+
+  /// Draw RGB565 pixels, clipped once for the whole block and copied row by row when not rotated.
+  void draw_rgb565_at(int x, int y, int width, int height, const uint8_t *data, size_t stride) override;
+
+  /// Draw an alpha bitmap without clipping every run when it is not rotated and lies fully within the clipping area.
+  void draw_alpha_bitmap_at(int x, int y, int width, int height, const uint8_t *data, uint8_t bpp, Color color,
+                            Color background) override;
+
  protected:
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
 
+  /** Fill a rectangle at the absolute (unrotated) position [x,y] with the given color.
+   * The rectangle is already clipped to the display, so implementations can write rows directly into the buffer.
+   * Defaults to calling draw_absolute_pixel_internal() for every pixel.
+   */
+  virtual void fill_absolute_rect_internal(int x, int y, int width, int height, Color color);
+
+  /** Draw a block of big-endian RGB565 pixels at the absolute position [x,y], see Display::draw_rgb565_at().
+   * Only used without rotation and with the block already clipped to the display.
+   * Defaults to calling draw_absolute_pixel_internal() for every pixel.
+   */
+  virtual void draw_absolute_rgb565_internal(int x, int y, int width, int height, const uint8_t *data, size_t stride);
+
+  /** Draw an alpha bitmap at the absolute position [x,y], see Display::draw_alpha_bitmap_at().
+   * Only used without rotation and with the whole bitmap on the display and inside the clipping rectangle.
+   * Defaults to filling every run of equal pixels with fill_absolute_rect_internal().
+   */
+  virtual void draw_absolute_alpha_bitmap_internal(int x, int y, int width, int height, const uint8_t *data,
+                                                   uint8_t bpp, Color color, Color background);
+
+  /** Clip the area from [min_x,min_y] up to but excluding [max_x,max_y] to the display and the clipping rectangle.
+   * Returns false if nothing is left to draw.
+   */
+  bool clip_rect_(int &min_x, int &min_y, int &max_x, int &max_y);
+
+  /** Copy length bytes from data, which may be stored in PROGMEM, into the buffer at dst.
+   * Returns true if the buffer contents changed.
+   */
+  static bool copy_row_(uint8_t *dst, const uint8_t *data, size_t length);
+
+  /** Compare the buffer against a shadow copy of what was last sent to the display.
+   * The buffer is treated as rows of row_length bytes, e.g. the pages of a page addressed controller. For every row
+   * that changed, changed(row, start, length) is called with the range of changed bytes in that row, after which
+   * the buffer is remembered as sent. The first call, or the first call after invalidate_shadow_buffer_(), reports
+   * every row as changed; so does every call if the shadow copy can't be allocated.
+   */
+  void diff_buffer_rows_(size_t rows, size_t row_length,
+                         const std::function<void(size_t row, size_t start, size_t length)> &changed);
+  /// Report the whole buffer as changed on the next diff_buffer_rows_() call, e.g. after the controller was reset.
+  void invalidate_shadow_buffer_() { this->shadow_valid_ = false; }
+
   void init_internal_(uint32_t buffer_length);
 
   uint8_t *buffer_{nullptr};
+  uint8_t *shadow_buffer_{nullptr};
+  bool shadow_valid_{false};
 };
 
 }  // namespace display
@@ -6,7 +6,10 @@
 #include "esphome/core/helpers.h"
 
 #include <array>
+#include <atomic>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #ifdef USE_ESP32
@@ -60,6 +63,59 @@ class ESPBLEiBeacon {
   } PACKED beacon_data_;
 };
 
+/// A single AD structure of an advertisement or scan response, pointing into the raw scan result.
+struct ADRecord {
+  uint8_t type;
+  uint8_t length;
+  const uint8_t *data;
+};
+
+/// Zero-copy view over the AD structures of a raw scan result. Records are located while iterating, nothing is
+/// parsed or copied, so the view can be used to look at advertisements without allocating.
+class ADRecordView {
+ public:
+  class Iterator {
+   public:
+    Iterator(const uint8_t *data, size_t length, size_t offset) : data_(data), length_(length), offset_(offset) {
+      this->read_();
+    }
+    const ADRecord &operator*() const { return this->record_; }
+    const ADRecord *operator->() const { return &this->record_; }
+    Iterator &operator++() {
+      this->offset_ = this->next_;
+      this->read_();
+      return *this;
+    }
+    bool operator==(const Iterator &other) const { return this->offset_ == other.offset_; }
+    bool operator!=(const Iterator &other) const { return this->offset_ != other.offset_; }
+
+   protected:
+    void read_();
+
+    const uint8_t *data_;
+    size_t length_;
+    size_t offset_;
+    size_t next_{0};
+    ADRecord record_{};
+  };
+
+  ADRecordView(const uint8_t *data, size_t length) : data_(data), length_(length) {}
+  explicit ADRecordView(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param)
+      : ADRecordView(param.ble_adv, param.adv_data_len + param.scan_rsp_len) {}
+
+  Iterator begin() const { return Iterator(this->data_, this->length_, 0); }
+  Iterator end() const { return Iterator(this->data_, this->length_, this->length_); }
+
+  /// Return the first AD structure of the given type.
+  optional<ADRecord> find(uint8_t type) const;
+
+ protected:
+  const uint8_t *data_;
+  size_t length_;
+};
+
+/// Adaptor that decodes the AD structures of a scan result into parsed fields. The fields are only decoded the
+/// first time one of them is requested.
 class ESPBTDevice {
  public:
   void parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
@@ -72,24 +128,46 @@ class ESPBTDevice {
 
   esp_ble_addr_type_t get_address_type() const { return this->address_type_; }
   int get_rssi() const { return rssi_; }
-  const std::string &get_name() const { return this->name_; }
+  const std::string &get_name() const {
+    this->parse_adv_();
+    return this->name_;
+  }
 
-  const std::vector<int8_t> &get_tx_powers() const { return tx_powers_; }
+  const std::vector<int8_t> &get_tx_powers() const {
+    this->parse_adv_();
+    return tx_powers_;
+  }
 
-  const optional<uint16_t> &get_appearance() const { return appearance_; }
-  const optional<uint8_t> &get_ad_flag() const { return ad_flag_; }
-  const std::vector<ESPBTUUID> &get_service_uuids() const { return service_uuids_; }
+  const optional<uint16_t> &get_appearance() const {
+    this->parse_adv_();
+    return appearance_;
+  }
+  const optional<uint8_t> &get_ad_flag() const {
+    this->parse_adv_();
+    return ad_flag_;
+  }
+  const std::vector<ESPBTUUID> &get_service_uuids() const {
+    this->parse_adv_();
+    return service_uuids_;
+  }
 
-  const std::vector<ServiceData> &get_manufacturer_datas() const { return manufacturer_datas_; }
+  const std::vector<ServiceData> &get_manufacturer_datas() const {
+    this->parse_adv_();
+    return manufacturer_datas_;
+  }
 
-  const std::vector<ServiceData> &get_service_datas() const { return service_datas_; }
+  const std::vector<ServiceData> &get_service_datas() const {
+    this->parse_adv_();
+    return service_datas_;
+  }
 
   const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &get_scan_result() const { return scan_result_; }
+  ADRecordView get_ad_records() const { return ADRecordView(this->scan_result_); }
 
   bool resolve_irk(const uint8_t *irk) const;
 
   optional<ESPBLEiBeacon> get_ibeacon() const {
-    for (auto &it : this->manufacturer_datas_) {
+    for (auto &it : this->get_manufacturer_datas()) {
       auto res = ESPBLEiBeacon::from_manufacturer_data(it);
       if (res.has_value())
         return *res;
@@ -98,20 +176,22 @@ class ESPBTDevice {
   }
 
  protected:
-  void parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
+  /// Decode the AD structures of scan_result_ into the fields below, once.
+  void parse_adv_() const;
 
   esp_bd_addr_t address_{
       0,
   };
   esp_ble_addr_type_t address_type_{BLE_ADDR_TYPE_PUBLIC};
   int rssi_{0};
-  std::string name_{};
-  std::vector<int8_t> tx_powers_{};
-  optional<uint16_t> appearance_{};
-  optional<uint8_t> ad_flag_{};
-  std::vector<ESPBTUUID> service_uuids_{};
-  std::vector<ServiceData> manufacturer_datas_{};
-  std::vector<ServiceData> service_datas_{};
+  mutable bool parsed_{false};
+  mutable std::string name_{};
+  mutable std::vector<int8_t> tx_powers_{};
+  mutable optional<uint16_t> appearance_{};
+  mutable optional<uint8_t> ad_flag_{};
+  mutable std::vector<ESPBTUUID> service_uuids_{};
+  mutable std::vector<ServiceData> manufacturer_datas_{};
+  mutable std::vector<ServiceData> service_datas_{};
   esp_ble_gap_cb_param_t::ble_scan_result_evt_param scan_result_{};
 };
 
@@ -129,8 +209,20 @@ class ESPBTDeviceListener {
   };
   void set_parent(ESP32BLETracker *parent) { parent_ = parent; }
 
+  /// Only offer devices to parse_device() that match at least one of the registered filters. Listeners without
+  /// filters are offered every device. Filters must be added before scanning starts.
+  void add_address_filter(uint64_t address) { this->address_filters_.push_back(address); }
+  void add_service_uuid_filter(const ESPBTUUID &uuid) { this->service_uuid_filters_.push_back(uuid); }
+  void add_manufacturer_uuid_filter(const ESPBTUUID &uuid) { this->manufacturer_uuid_filters_.push_back(uuid); }
+  const std::vector<uint64_t> &get_address_filters() const { return this->address_filters_; }
+  const std::vector<ESPBTUUID> &get_service_uuid_filters() const { return this->service_uuid_filters_; }
+  const std::vector<ESPBTUUID> &get_manufacturer_uuid_filters() const { return this->manufacturer_uuid_filters_; }
+
  protected:
   ESP32BLETracker *parent_{nullptr};
+  std::vector<uint64_t> address_filters_;
+  std::vector<ESPBTUUID> service_uuid_filters_;
+  std::vector<ESPBTUUID> manufacturer_uuid_filters_;
 };
 
 enum class ClientState {
@@ -202,6 +294,14 @@ class ESP32BLETracker : public Component,
   void set_scan_window(uint32_t scan_window) { scan_window_ = scan_window; }
   void set_scan_active(bool scan_active) { scan_active_ = scan_active; }
   void set_scan_continuous(bool scan_continuous) { scan_continuous_ = scan_continuous; }
+  void set_scan_result_queue_size(uint32_t scan_result_queue_size) {
+    this->scan_result_queue_size_ = scan_result_queue_size;
+  }
+
+  /// Number of scan results handed to the listeners since boot.
+  uint32_t get_scan_results_processed() const { return this->scan_results_processed_; }
+  /// Number of scan results dropped since boot because the queue was full.
+  uint32_t get_scan_results_dropped() const { return this->scan_results_dropped_.load(std::memory_order_relaxed); }
 
   /// Setup the FreeRTOS task and the Bluetooth stack.
   void setup() override;
@@ -230,6 +330,10 @@ class ESP32BLETracker : public Component,
   void start_scan_(bool first);
   /// Called when a scan ends
   void end_of_scan_();
+  /// Build the lookup tables used by dispatch_device_() from the listener filters.
+  void build_listener_index_();
+  /// Offer a device to the listeners whose filters match it, returns true if any of them handled it.
+  bool dispatch_device_(const ESPBTDevice &device);
   /// Called when a `ESP_GAP_BLE_SCAN_RESULT_EVT` event is received.
   void gap_scan_result_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
   /// Called when a `ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT` event is received.
@@ -244,6 +348,14 @@ class ESP32BLETracker : public Component,
   /// Vector of addresses that have already been printed in print_bt_device_info
   std::vector<uint64_t> already_discovered_;
   std::vector<ESPBTDeviceListener *> listeners_;
+  /// Listeners offered every device, and listeners indexed by the devices they are interested in.
+  std::vector<ESPBTDeviceListener *> wildcard_listeners_;
+  std::unordered_map<uint64_t, std::vector<ESPBTDeviceListener *>> address_listeners_;
+  std::vector<std::pair<ESPBTUUID, ESPBTDeviceListener *>> service_uuid_listeners_;
+  std::vector<std::pair<ESPBTUUID, ESPBTDeviceListener *>> manufacturer_uuid_listeners_;
+  /// Listeners matched for the device currently being dispatched, kept to avoid reallocating.
+  std::vector<ESPBTDeviceListener *> matched_listeners_;
+  bool listener_index_valid_{false};
   /// Client parameters.
   std::vector<ESPBTClient *> clients_;
   /// A structure holding the ESP BLE scan parameters.
@@ -259,15 +371,22 @@ class ESP32BLETracker : public Component,
   bool ble_was_disabled_{true};
   bool raw_advertisements_{false};
   bool parse_advertisements_{false};
-  SemaphoreHandle_t scan_result_lock_;
   SemaphoreHandle_t scan_end_lock_;
-  size_t scan_result_index_{0};
 #ifdef USE_PSRAM
   const static u_int8_t SCAN_RESULT_BUFFER_SIZE = 32;
 #else
   const static u_int8_t SCAN_RESULT_BUFFER_SIZE = 16;
 #endif  // USE_PSRAM
+  uint32_t scan_result_queue_size_{SCAN_RESULT_BUFFER_SIZE};
+  /// Single producer, single consumer ring of scan results. The BT task writes at scan_result_write_, loop() reads
+  /// from scan_result_read_. One slot is always kept free to tell a full ring from an empty one.
   esp_ble_gap_cb_param_t::ble_scan_result_evt_param *scan_result_buffer_;
+  uint32_t scan_result_slots_{0};
+  std::atomic<uint32_t> scan_result_write_{0};
+  std::atomic<uint32_t> scan_result_read_{0};
+  std::atomic<uint32_t> scan_results_dropped_{0};
+  uint32_t scan_results_dropped_reported_{0};
+  uint32_t scan_results_processed_{0};
   esp_bt_status_t scan_start_failed_{ESP_BT_STATUS_SUCCESS};
   esp_bt_status_t scan_set_param_failed_{ESP_BT_STATUS_SUCCESS};
   int connecting_{0};
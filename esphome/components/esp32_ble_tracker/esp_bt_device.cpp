@@ -0,0 +1,302 @@
+#ifdef USE_ESP32
+
+#include "esp32_ble_tracker.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace esphome {
+namespace esp32_ble_tracker {
+
+static const char *const TAG = "esp32_ble_tracker";
+
+ESPBLEiBeacon::ESPBLEiBeacon(const uint8_t *data) { memcpy(&this->beacon_data_, data, sizeof(beacon_data_)); }
+optional<ESPBLEiBeacon> ESPBLEiBeacon::from_manufacturer_data(const ServiceData &data) {
+  if (!data.uuid.contains(0x4C, 0x00))
+    return {};
+
+  if (data.data.size() != 23)
+    return {};
+  return ESPBLEiBeacon(data.data.data());
+}
+
+void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) {
+  this->scan_result_ = param;
+  for (uint8_t i = 0; i < ESP_BD_ADDR_LEN; i++)
+    this->address_[i] = param.bda[i];
+  this->address_type_ = param.ble_addr_type;
+  this->rssi_ = param.rssi;
+  this->parsed_ = false;
+  this->name_.clear();
+  this->tx_powers_.clear();
+  this->appearance_.reset();
+  this->ad_flag_.reset();
+  this->service_uuids_.clear();
+  this->manufacturer_datas_.clear();
+  this->service_datas_.clear();
+
+#ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
+  this->parse_adv_();
+  ESP_LOGVV(TAG, "Parse Result:");
+  const char *address_type;
+  switch (this->address_type_) {
+    case BLE_ADDR_TYPE_PUBLIC:
+      address_type = "PUBLIC";
+      break;
+    case BLE_ADDR_TYPE_RANDOM:
+      address_type = "RANDOM";
+      break;
+    case BLE_ADDR_TYPE_RPA_PUBLIC:
+      address_type = "RPA_PUBLIC";
+      break;
+    case BLE_ADDR_TYPE_RPA_RANDOM:
+      address_type = "RPA_RANDOM";
+      break;
+    default:
+      address_type = "UNKNOWN";
+      break;
+  }
+  ESP_LOGVV(TAG, "  Address: %02X:%02X:%02X:%02X:%02X:%02X (%s)", this->address_[0], this->address_[1],
+            this->address_[2], this->address_[3], this->address_[4], this->address_[5], address_type);
+
+  ESP_LOGVV(TAG, "  RSSI: %d", this->rssi_);
+  ESP_LOGVV(TAG, "  Name: '%s'", this->name_.c_str());
+  for (auto &it : this->tx_powers_) {
+    ESP_LOGVV(TAG, "  TX Power: %d", it);
+  }
+  if (this->appearance_.has_value()) {
+    ESP_LOGVV(TAG, "  Appearance: %u", *this->appearance_);
+  }
+  if (this->ad_flag_.has_value()) {
+    ESP_LOGVV(TAG, "  Ad Flag: %u", *this->ad_flag_);
+  }
+  for (auto &uuid : this->service_uuids_) {
+    ESP_LOGVV(TAG, "  Service UUID: %s", uuid.to_string().c_str());
+  }
+  for (auto &data : this->manufacturer_datas_) {
+    auto ibeacon = ESPBLEiBeacon::from_manufacturer_data(data);
+    if (ibeacon.has_value()) {
+      ESP_LOGVV(TAG, "  Manufacturer iBeacon:");
+      ESP_LOGVV(TAG, "    UUID: %s", ibeacon.value().get_uuid().to_string().c_str());
+      ESP_LOGVV(TAG, "    Major: %u", ibeacon.value().get_major());
+      ESP_LOGVV(TAG, "    Minor: %u", ibeacon.value().get_minor());
+      ESP_LOGVV(TAG, "    TXPower: %d", ibeacon.value().get_signal_power());
+    } else {
+      ESP_LOGVV(TAG, "  Manufacturer ID: %s, data: %s", data.uuid.to_string().c_str(),
+                format_hex_pretty(data.data).c_str());
+    }
+  }
+  for (auto &data : this->service_datas_) {
+    ESP_LOGVV(TAG, "  Service data:");
+    ESP_LOGVV(TAG, "    UUID: %s", data.uuid.to_string().c_str());
+    ESP_LOGVV(TAG, "    Data: %s", format_hex_pretty(data.data).c_str());
+  }
+
+  ESP_LOGVV(TAG, "  Adv data: %s", format_hex_pretty(param.ble_adv, param.adv_data_len + param.scan_rsp_len).c_str());
+#endif
+}
+void ADRecordView::Iterator::read_() {
+  while (this->offset_ < this->length_) {
+    // First byte is length of adv record, including the type
+    const uint8_t field_length = this->data_[this->offset_];
+    if (field_length == 0) {
+      // Possible zero padded advertisement data
+      this->offset_++;
+      continue;
+    }
+    if (this->offset_ + 1 + field_length > this->length_) {
+      // Truncated record
+      break;
+    }
+    this->record_.type = this->data_[this->offset_ + 1];
+    this->record_.length = field_length - 1;
+    this->record_.data = &this->data_[this->offset_ + 2];
+    this->next_ = this->offset_ + 1 + field_length;
+    return;
+  }
+  this->offset_ = this->length_;
+}
+
+optional<ADRecord> ADRecordView::find(uint8_t type) const {
+  for (const auto &record : *this) {
+    if (record.type == type)
+      return record;
+  }
+  return {};
+}
+
+void ESPBTDevice::parse_adv_() const {
+  if (this->parsed_)
+    return;
+  this->parsed_ = true;
+
+  for (const auto &ad : ADRecordView(this->scan_result_)) {
+    const uint8_t record_type = ad.type;
+    const uint8_t *record = ad.data;
+    const uint8_t record_length = ad.length;
+
+    // See also Generic Access Profile Assigned Numbers:
+    // https://www.bluetooth.com/specifications/assigned-numbers/generic-access-profile/ See also ADVERTISING AND SCAN
+    // RESPONSE DATA FORMAT: https://www.bluetooth.com/specifications/bluetooth-core-specification/ (vol 3, part C, 11)
+    // See also Core Specification Supplement: https://www.bluetooth.com/specifications/bluetooth-core-specification/
+    // (called CSS here)
+
+    switch (record_type) {
+      case ESP_BLE_AD_TYPE_NAME_SHORT:
+      case ESP_BLE_AD_TYPE_NAME_CMPL: {
+        // CSS 1.2 LOCAL NAME
+        // "The Local Name data type shall be the same as, or a shortened version of, the local name assigned to the
+        // device." CSS 1: Optional in this context; shall not appear more than once in a block.
+        // SHORTENED LOCAL NAME
+        // "The Shortened Local Name data type defines a shortened version of the Local Name data type. The Shortened
+        // Local Name data type shall not be used to advertise a name that is longer than the Local Name data type."
+        if (record_length > this->name_.length()) {
+          this->name_ = std::string(reinterpret_cast<const char *>(record), record_length);
+        }
+        break;
+      }
+      case ESP_BLE_AD_TYPE_TX_PWR: {
+        // CSS 1.5 TX POWER LEVEL
+        // "The TX Power Level data type indicates the transmitted power level of the packet containing the data type."
+        // CSS 1: Optional in this context (may appear more than once in a block).
+        if (record_length < 1)
+          break;
+        this->tx_powers_.push_back(*record);
+        break;
+      }
+      case ESP_BLE_AD_TYPE_APPEARANCE: {
+        // CSS 1.12 APPEARANCE
+        // "The Appearance data type defines the external appearance of the device."
+        // See also https://www.bluetooth.com/specifications/gatt/characteristics/
+        // CSS 1: Optional in this context; shall not appear more than once in a block and shall not appear in both
+        // the AD and SRD of the same extended advertising interval.
+        if (record_length < 2)
+          break;
+        this->appearance_ = *reinterpret_cast<const uint16_t *>(record);
+        break;
+      }
+      case ESP_BLE_AD_TYPE_FLAG: {
+        // CSS 1.3 FLAGS
+        // "The Flags data type contains one bit Boolean flags. The Flags data type shall be included when any of the
+        // Flag bits are non-zero and the advertising packet is connectable, otherwise the Flags data type may be
+        // omitted."
+        // CSS 1: Optional in this context; shall not appear more than once in a block.
+        if (record_length < 1)
+          break;
+        this->ad_flag_ = *record;
+        break;
+      }
+      // CSS 1.1 SERVICE UUID
+      // The Service UUID data type is used to include a list of Service or Service Class UUIDs.
+      // There are six data types defined for the three sizes of Service UUIDs that may be returned:
+      // CSS 1: Optional in this context (may appear more than once in a block).
+      case ESP_BLE_AD_TYPE_16SRV_CMPL:
+      case ESP_BLE_AD_TYPE_16SRV_PART: {
+        // • 16-bit Bluetooth Service UUIDs
+        for (uint8_t i = 0; i < record_length / 2; i++) {
+          this->service_uuids_.push_back(ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record + 2 * i)));
+        }
+        break;
+      }
+      case ESP_BLE_AD_TYPE_32SRV_CMPL:
+      case ESP_BLE_AD_TYPE_32SRV_PART: {
+        // • 32-bit Bluetooth Service UUIDs
+        for (uint8_t i = 0; i < record_length / 4; i++) {
+          this->service_uuids_.push_back(ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record + 4 * i)));
+        }
+        break;
+      }
+      case ESP_BLE_AD_TYPE_128SRV_CMPL:
+      case ESP_BLE_AD_TYPE_128SRV_PART: {
+        // • Global 128-bit Service UUIDs
+        if (record_length < 16)
+          break;
+        this->service_uuids_.push_back(ESPBTUUID::from_raw(record));
+        break;
+      }
+      case ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE: {
+        // CSS 1.4 MANUFACTURER SPECIFIC DATA
+        // "The Manufacturer Specific data type is used for manufacturer specific data. The first two data octets shall
+        // contain a company identifier from Assigned Numbers. The interpretation of any other octets within the data
+        // shall be defined by the manufacturer specified by the company identifier."
+        // CSS 1: Optional in this context (may appear more than once in a block).
+        if (record_length < 2) {
+          ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE");
+          break;
+        }
+        ServiceData data{};
+        data.uuid = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
+        data.data.assign(record + 2UL, record + record_length);
+        this->manufacturer_datas_.push_back(data);
+        break;
+      }
+
+      // CSS 1.11 SERVICE DATA
+      // "The Service Data data type consists of a service UUID with the data associated with that service."
+      // CSS 1: Optional in this context (may appear more than once in a block).
+      case ESP_BLE_AD_TYPE_SERVICE_DATA: {
+        // «Service Data - 16 bit UUID»
+        // Size: 2 or more octets
+        // The first 2 octets contain the 16 bit Service UUID fol- lowed by additional service data
+        if (record_length < 2) {
+          ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_SERVICE_DATA");
+          break;
+        }
+        ServiceData data{};
+        data.uuid = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
+        data.data.assign(record + 2UL, record + record_length);
+        this->service_datas_.push_back(data);
+        break;
+      }
+      case ESP_BLE_AD_TYPE_32SERVICE_DATA: {
+        // «Service Data - 32 bit UUID»
+        // Size: 4 or more octets
+        // The first 4 octets contain the 32 bit Service UUID fol- lowed by additional service data
+        if (record_length < 4) {
+          ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_32SERVICE_DATA");
+          break;
+        }
+        ServiceData data{};
+        data.uuid = ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record));
+        data.data.assign(record + 4UL, record + record_length);
+        this->service_datas_.push_back(data);
+        break;
+      }
+      case ESP_BLE_AD_TYPE_128SERVICE_DATA: {
+        // «Service Data - 128 bit UUID»
+        // Size: 16 or more octets
+        // The first 16 octets contain the 128 bit Service UUID followed by additional service data
+        if (record_length < 16) {
+          ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_128SERVICE_DATA");
+          break;
+        }
+        ServiceData data{};
+        data.uuid = ESPBTUUID::from_raw(record);
+        data.data.assign(record + 16UL, record + record_length);
+        this->service_datas_.push_back(data);
+        break;
+      }
+      case ESP_BLE_AD_TYPE_INT_RANGE:
+        // Avoid logging this as it's very verbose
+        break;
+      default: {
+        ESP_LOGV(TAG, "Unhandled type: advType: 0x%02x", record_type);
+        break;
+      }
+    }
+  }
+}
+std::string ESPBTDevice::address_str() const {
+  char mac[24];
+  snprintf(mac, sizeof(mac), "%02X:%02X:%02X:%02X:%02X:%02X", this->address_[0], this->address_[1], this->address_[2],
+           this->address_[3], this->address_[4], this->address_[5]);
+  return mac;
+}
+uint64_t ESPBTDevice::address_uint64() const { return esp32_ble::ble_addr_to_uint64(this->address_); }
+
+}  // namespace esp32_ble_tracker
+}  // namespace esphome
+
+#endif
@@ -0,0 +1,52 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_ID,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_COUNTER,
+    STATE_CLASS_TOTAL_INCREASING,
+)
+
+from .. import CONF_ESP32_BLE_ID, ESP32BLETracker, esp32_ble_tracker_ns
+
+CONF_SCAN_RESULTS_PROCESSED = "scan_results_processed"
+CONF_SCAN_RESULTS_DROPPED = "scan_results_dropped"
+
+ESP32BLETrackerStats = esp32_ble_tracker_ns.class_(
+    "ESP32BLETrackerStats", cg.PollingComponent
+)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(ESP32BLETrackerStats),
+        cv.GenerateID(CONF_ESP32_BLE_ID): cv.use_id(ESP32BLETracker),
+        cv.Optional(CONF_SCAN_RESULTS_PROCESSED): sensor.sensor_schema(
+            icon=ICON_COUNTER,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_SCAN_RESULTS_DROPPED): sensor.sensor_schema(
+            icon=ICON_COUNTER,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+).extend(cv.polling_component_schema("60s"))
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    tracker = await cg.get_variable(config[CONF_ESP32_BLE_ID])
+    cg.add(var.set_tracker(tracker))
+
+    if processed_config := config.get(CONF_SCAN_RESULTS_PROCESSED):
+        sens = await sensor.new_sensor(processed_config)
+        cg.add(var.set_scan_results_processed_sensor(sens))
+    if dropped_config := config.get(CONF_SCAN_RESULTS_DROPPED):
+        sens = await sensor.new_sensor(dropped_config)
+        cg.add(var.set_scan_results_dropped_sensor(sens))
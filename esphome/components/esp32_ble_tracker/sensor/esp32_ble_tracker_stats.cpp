@@ -0,0 +1,28 @@
+#include "esp32_ble_tracker_stats.h"
+#include "esphome/core/log.h"
+
+#ifdef USE_ESP32
+
+namespace esphome {
+namespace esp32_ble_tracker {
+
+static const char *const TAG = "esp32_ble_tracker.stats";
+
+void ESP32BLETrackerStats::update() {
+  if (this->scan_results_processed_sensor_ != nullptr)
+    this->scan_results_processed_sensor_->publish_state(this->tracker_->get_scan_results_processed());
+  if (this->scan_results_dropped_sensor_ != nullptr)
+    this->scan_results_dropped_sensor_->publish_state(this->tracker_->get_scan_results_dropped());
+}
+
+void ESP32BLETrackerStats::dump_config() {
+  ESP_LOGCONFIG(TAG, "BLE Tracker Stats:");
+  LOG_UPDATE_INTERVAL(this);
+  LOG_SENSOR("  ", "Scan Results Processed", this->scan_results_processed_sensor_);
+  LOG_SENSOR("  ", "Scan Results Dropped", this->scan_results_dropped_sensor_);
+}
+
+}  // namespace esp32_ble_tracker
+}  // namespace esphome
+
+#endif
@@ -0,0 +1,35 @@
+#pragma once
+
+#ifdef USE_ESP32
+
+#include "../esp32_ble_tracker.h"
+#include "esphome/core/component.h"
+#include "esphome/components/sensor/sensor.h"
+
+namespace esphome {
+namespace esp32_ble_tracker {
+
+/// Reports how many scan results went through the tracker queue and how many were dropped because it was full.
+class ESP32BLETrackerStats : public PollingComponent {
+ public:
+  void set_tracker(ESP32BLETracker *tracker) { this->tracker_ = tracker; }
+  void set_scan_results_processed_sensor(sensor::Sensor *scan_results_processed_sensor) {
+    this->scan_results_processed_sensor_ = scan_results_processed_sensor;
+  }
+  void set_scan_results_dropped_sensor(sensor::Sensor *scan_results_dropped_sensor) {
+    this->scan_results_dropped_sensor_ = scan_results_dropped_sensor;
+  }
+
+  void update() override;
+  void dump_config() override;
+
+ protected:
+  ESP32BLETracker *tracker_;
+  sensor::Sensor *scan_results_processed_sensor_{nullptr};
+  sensor::Sensor *scan_results_dropped_sensor_{nullptr};
+};
+
+}  // namespace esp32_ble_tracker
+}  // namespace esphome
+
+#endif
@@ -21,6 +21,74 @@ static const uint32_t RMT_CLK_FREQ = 80000000;
 static const uint8_t RMT_CLK_DIV = 2;
 #endif
 
+#if ESP_IDF_VERSION_MAJOR >= 5
+// Encodes the LED buffer on the fly with a bytes encoder, followed by the optional reset symbol, so that the RMT
+// symbols only ever need to fit into the channel memory instead of being expanded for the whole strip up front.
+struct LEDStripEncoder {
+  rmt_encoder_t base;
+  rmt_encoder_handle_t bytes_encoder;
+  rmt_encoder_handle_t copy_encoder;
+  rmt_symbol_word_t reset;
+  bool send_reset;
+  bool sending_reset;
+};
+
+static size_t encode_led_strip(rmt_encoder_t *encoder, rmt_channel_handle_t channel, const void *data, size_t size,
+                               rmt_encode_state_t *ret_state) {
+  auto *led_encoder = reinterpret_cast<LEDStripEncoder *>(encoder);
+  rmt_encode_state_t session_state = RMT_ENCODING_RESET;
+  int state = RMT_ENCODING_RESET;
+  size_t encoded_symbols = 0;
+
+  if (!led_encoder->sending_reset) {
+    encoded_symbols +=
+        led_encoder->bytes_encoder->encode(led_encoder->bytes_encoder, channel, data, size, &session_state);
+    if (session_state & RMT_ENCODING_COMPLETE) {
+      if (led_encoder->send_reset) {
+        led_encoder->sending_reset = true;
+      } else {
+        state |= RMT_ENCODING_COMPLETE;
+      }
+    }
+    if (session_state & RMT_ENCODING_MEM_FULL) {
+      // yield until the channel memory has room for more symbols
+      *ret_state = rmt_encode_state_t(state | RMT_ENCODING_MEM_FULL);
+      return encoded_symbols;
+    }
+  }
+  if (led_encoder->sending_reset) {
+    encoded_symbols += led_encoder->copy_encoder->encode(led_encoder->copy_encoder, channel, &led_encoder->reset,
+                                                         sizeof(led_encoder->reset), &session_state);
+    if (session_state & RMT_ENCODING_COMPLETE) {
+      led_encoder->sending_reset = false;
+      state |= RMT_ENCODING_COMPLETE;
+    }
+    if (session_state & RMT_ENCODING_MEM_FULL)
+      state |= RMT_ENCODING_MEM_FULL;
+  }
+  *ret_state = rmt_encode_state_t(state);
+  return encoded_symbols;
+}
+
+static esp_err_t reset_led_strip_encoder(rmt_encoder_t *encoder) {
+  auto *led_encoder = reinterpret_cast<LEDStripEncoder *>(encoder);
+  rmt_encoder_reset(led_encoder->bytes_encoder);
+  rmt_encoder_reset(led_encoder->copy_encoder);
+  led_encoder->sending_reset = false;
+  return ESP_OK;
+}
+
+static esp_err_t delete_led_strip_encoder(rmt_encoder_t *encoder) {
+  auto *led_encoder = reinterpret_cast<LEDStripEncoder *>(encoder);
+  if (led_encoder->bytes_encoder != nullptr)
+    rmt_del_encoder(led_encoder->bytes_encoder);
+  if (led_encoder->copy_encoder != nullptr)
+    rmt_del_encoder(led_encoder->copy_encoder);
+  delete led_encoder;  // NOLINT(cppcoreguidelines-owning-memory)
+  return ESP_OK;
+}
+#endif
+
 void ESP32RMTLEDStripLightOutput::setup() {
   ESP_LOGCONFIG(TAG, "Setting up ESP32 LED Strip...");
 
@@ -35,6 +103,19 @@ void ESP32RMTLEDStripLightOutput::setup() {
   }
   memset(this->buf_, 0, buffer_size);
 
+  // The frame being sent is copied, so that the next frame can be rendered into buf_ in the meantime
+#if ESP_IDF_VERSION_MAJOR >= 5
+  this->tx_buf_ = allocator.allocate(buffer_size);
+#else
+  // one more byte that stands in for the reset item, see translate_()
+  this->tx_buf_ = allocator.allocate(buffer_size + 1);
+#endif
+  if (this->tx_buf_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate transmit buffer!");
+    this->mark_failed();
+    return;
+  }
+
   this->effect_data_ = allocator.allocate(this->num_leds_);
   if (this->effect_data_ == nullptr) {
     ESP_LOGE(TAG, "Cannot allocate effect data!");
@@ -43,11 +124,6 @@ void ESP32RMTLEDStripLightOutput::setup() {
   }
 
 #if ESP_IDF_VERSION_MAJOR >= 5
-  RAMAllocator<rmt_symbol_word_t> rmt_allocator(this->use_psram_ ? 0 : RAMAllocator<rmt_symbol_word_t>::ALLOC_INTERNAL);
-
-  // 8 bits per byte, 1 rmt_symbol_word_t per bit + 1 rmt_symbol_word_t for reset
-  this->rmt_buf_ = rmt_allocator.allocate(buffer_size * 8 + 1);
-
   rmt_tx_channel_config_t channel;
   memset(&channel, 0, sizeof(channel));
   channel.clk_src = RMT_CLK_SRC_DEFAULT;
@@ -66,13 +142,28 @@ void ESP32RMTLEDStripLightOutput::setup() {
     return;
   }
 
-  rmt_copy_encoder_config_t encoder;
-  memset(&encoder, 0, sizeof(encoder));
-  if (rmt_new_copy_encoder(&encoder, &this->encoder_) != ESP_OK) {
+  auto *led_encoder = new LEDStripEncoder();  // NOLINT(cppcoreguidelines-owning-memory)
+  led_encoder->base.encode = encode_led_strip;
+  led_encoder->base.reset = reset_led_strip_encoder;
+  led_encoder->base.del = delete_led_strip_encoder;
+  led_encoder->reset = this->reset_;
+  led_encoder->send_reset = this->has_reset_();
+
+  rmt_bytes_encoder_config_t bytes_encoder;
+  memset(&bytes_encoder, 0, sizeof(bytes_encoder));
+  bytes_encoder.bit0 = this->bit0_;
+  bytes_encoder.bit1 = this->bit1_;
+  bytes_encoder.flags.msb_first = 1;
+  rmt_copy_encoder_config_t copy_encoder;
+  memset(&copy_encoder, 0, sizeof(copy_encoder));
+  if (rmt_new_bytes_encoder(&bytes_encoder, &led_encoder->bytes_encoder) != ESP_OK ||
+      rmt_new_copy_encoder(&copy_encoder, &led_encoder->copy_encoder) != ESP_OK) {
     ESP_LOGE(TAG, "Encoder creation failed");
+    delete_led_strip_encoder(&led_encoder->base);
     this->mark_failed();
     return;
   }
+  this->encoder_ = &led_encoder->base;
 
   if (rmt_enable(this->channel_) != ESP_OK) {
     ESP_LOGE(TAG, "Enabling channel failed");
@@ -80,11 +171,6 @@ void ESP32RMTLEDStripLightOutput::setup() {
     return;
   }
 #else
-  RAMAllocator<rmt_item32_t> rmt_allocator(this->use_psram_ ? 0 : RAMAllocator<rmt_item32_t>::ALLOC_INTERNAL);
-
-  // 8 bits per byte, 1 rmt_item32_t per bit + 1 rmt_item32_t for reset
-  this->rmt_buf_ = rmt_allocator.allocate(buffer_size * 8 + 1);
-
   rmt_config_t config;
   memset(&config, 0, sizeof(config));
   config.channel = this->channel_;
@@ -108,6 +194,12 @@ void ESP32RMTLEDStripLightOutput::setup() {
     this->mark_failed();
     return;
   }
+  if (rmt_translator_init(config.channel, translate_) != ESP_OK ||
+      rmt_translator_set_context(config.channel, this) != ESP_OK) {
+    ESP_LOGE(TAG, "Cannot install RMT translator!");
+    this->mark_failed();
+    return;
+  }
 #endif
 }
 
@@ -157,41 +249,16 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
   }
   delayMicroseconds(50);
 
-  size_t buffer_size = this->get_buffer_size_();
-
-  size_t size = 0;
-  size_t len = 0;
-  uint8_t *psrc = this->buf_;
-#if ESP_IDF_VERSION_MAJOR >= 5
-  rmt_symbol_word_t *pdest = this->rmt_buf_;
-#else
-  rmt_item32_t *pdest = this->rmt_buf_;
-#endif
-  while (size < buffer_size) {
-    uint8_t b = *psrc;
-    for (int i = 0; i < 8; i++) {
-      pdest->val = b & (1 << (7 - i)) ? this->bit1_.val : this->bit0_.val;
-      pdest++;
-      len++;
-    }
-    size++;
-    psrc++;
-  }
-
-  if (this->reset_.duration0 > 0 || this->reset_.duration1 > 0) {
-    pdest->val = this->reset_.val;
-    pdest++;
-    len++;
-  }
-
+  // The buffer is encoded into RMT symbols on the fly while it is being sent
+  memcpy(this->tx_buf_, this->buf_, this->get_buffer_size_());
 #if ESP_IDF_VERSION_MAJOR >= 5
   rmt_transmit_config_t config;
   memset(&config, 0, sizeof(config));
   config.loop_count = 0;
   config.flags.eot_level = 0;
-  error = rmt_transmit(this->channel_, this->encoder_, this->rmt_buf_, len * sizeof(rmt_symbol_word_t), &config);
+  error = rmt_transmit(this->channel_, this->encoder_, this->tx_buf_, this->get_buffer_size_(), &config);
 #else
-  error = rmt_write_items(this->channel_, this->rmt_buf_, len, false);
+  error = rmt_write_sample(this->channel_, this->tx_buf_, this->get_buffer_size_() + this->has_reset_(), false);
 #endif
   if (error != ESP_OK) {
     ESP_LOGE(TAG, "RMT TX error");
@@ -283,6 +350,37 @@ void ESP32RMTLEDStripLightOutput::dump_config() {
   ESP_LOGCONFIG(TAG, "  Number of LEDs: %u", this->num_leds_);
 }
 
+#if ESP_IDF_VERSION_MAJOR < 5
+void ESP32RMTLEDStripLightOutput::translate_(const void *src, rmt_item32_t *dest, size_t src_size, size_t wanted_num,
+                                             size_t *translated_size, size_t *item_num) {
+  ESP32RMTLEDStripLightOutput *output;
+  rmt_translator_get_context(item_num, reinterpret_cast<void **>(&output));
+  const uint8_t *psrc = static_cast<const uint8_t *>(src);
+  // The driver ends the transmission after the first chunk with fewer than wanted_num items, so chunks must be
+  // filled completely while there is data left. The reset item is sent as one extra source byte after the LED data
+  // instead, which always ends up in a short, and thus final, chunk of its own or after the last byte.
+  const uint8_t *reset = output->tx_buf_ + output->get_buffer_size_();
+  size_t size = 0;
+  size_t num = 0;
+  while (size < src_size) {
+    if (psrc + size == reset) {
+      if (num + 1 > wanted_num)
+        break;
+      dest[num++].val = output->reset_.val;
+      size++;
+      continue;
+    }
+    if (num + 8 > wanted_num)
+      break;
+    uint8_t b = psrc[size++];
+    for (int i = 0; i < 8; i++)
+      dest[num++].val = b & (1 << (7 - i)) ? output->bit1_.val : output->bit0_.val;
+  }
+  *translated_size = size;
+  *item_num = num;
+}
+#endif
+
 float ESP32RMTLEDStripLightOutput::get_setup_priority() const { return setup_priority::HARDWARE; }
 
 }  // namespace esp32_rmt_led_strip
@@ -77,17 +77,22 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
   light::ESPColorView get_view_internal(int32_t index) const override;
 
   size_t get_buffer_size_() const { return this->num_leds_ * (this->is_rgbw_ || this->is_wrgb_ ? 4 : 3); }
+  bool has_reset_() const { return this->reset_.duration0 > 0 || this->reset_.duration1 > 0; }
+#if ESP_IDF_VERSION_MAJOR < 5
+  /// Expands the LED buffer into RMT items in the chunks the driver asks for, followed by the reset item.
+  static void translate_(const void *src, rmt_item32_t *dest, size_t src_size, size_t wanted_num,
+                         size_t *translated_size, size_t *item_num);
+#endif
 
   uint8_t *buf_{nullptr};
+  uint8_t *tx_buf_{nullptr};
   uint8_t *effect_data_{nullptr};
 #if ESP_IDF_VERSION_MAJOR >= 5
   rmt_channel_handle_t channel_{nullptr};
   rmt_encoder_handle_t encoder_{nullptr};
-  rmt_symbol_word_t *rmt_buf_{nullptr};
   rmt_symbol_word_t bit0_, bit1_, reset_;
   uint32_t rmt_symbols_;
 #else
-  rmt_item32_t *rmt_buf_{nullptr};
   rmt_item32_t bit0_, bit1_, reset_;
   rmt_channel_t channel_{RMT_CHANNEL_0};
 #endif
@@ -43,6 +43,7 @@ Glyph = font_ns.class_("Glyph")
 GlyphData = font_ns.struct("GlyphData")
 
 CONF_BPP = "bpp"
+CONF_CACHE_SIZE = "cache_size"
 CONF_EXTRAS = "extras"
 CONF_FONTS = "fonts"
 CONF_GLYPHSETS = "glyphsets"
@@ -456,6 +457,7 @@ FONT_SCHEMA = cv.Schema(
         cv.Optional(CONF_IGNORE_MISSING_GLYPHS, default=False): cv.boolean,
         cv.Optional(CONF_SIZE): cv.int_range(min=1),
         cv.Optional(CONF_BPP, default=1): cv.one_of(1, 2, 4, 8),
+        cv.Optional(CONF_CACHE_SIZE, default=0): cv.int_range(min=0, max=32),
         cv.Optional(CONF_EXTRAS, default=[]): cv.ensure_list(
             cv.Schema(
                 {
@@ -607,7 +609,7 @@ async def to_code(config):
             ascender = font_height
         else:
             _LOGGER.error("Unable to determine height of font %s", config[CONF_FILE])
-    cg.new_Pvariable(
+    var = cg.new_Pvariable(
         config[CONF_ID],
         glyphs,
         len(glyph_initializer),
@@ -615,3 +617,5 @@ async def to_code(config):
         font_height,
         bpp,
     )
+    if config[CONF_CACHE_SIZE]:
+        cg.add(var.set_cache_size(config[CONF_CACHE_SIZE]))
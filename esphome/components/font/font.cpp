@@ -1,5 +1,8 @@
 #include "font.h"
 
+#include <algorithm>
+#include <climits>
+
 #include "esphome/core/color.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -100,71 +103,137 @@ void Font::measure(const char *str, int *width, int *x_offset, int *baseline, in
   *x_offset = min_x;
   *width = x - min_x;
 }
-void Font::print(int x_start, int y_start, display::Display *display, Color color, const char *text, Color background) {
+// Call f(glyph_data, x, str) for every glyph of str, glyph_data is nullptr for characters missing in the font.
+template<typename F> static void for_each_glyph(Font *font, const char *str, F &&f) {
   int i = 0;
-  int x_at = x_start;
-  int scan_x1, scan_y1, scan_width, scan_height;
-  while (text[i] != '\0') {
+  int x_at = 0;
+  while (str[i] != '\0') {
     int match_length;
-    int glyph_n = this->match_next_glyph((const uint8_t *) text + i, &match_length);
+    int glyph_n = font->match_next_glyph((const uint8_t *) str + i, &match_length);
     if (glyph_n < 0) {
+      f(nullptr, x_at, str + i);
       // Unknown char, skip
-      ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", text[i]);
+      if (!font->get_glyphs().empty())
+        x_at += font->get_glyphs()[0].get_glyph_data()->advance;
+      i++;
+      continue;
+    }
+
+    const GlyphData *glyph_data = font->get_glyphs()[glyph_n].get_glyph_data();
+    f(glyph_data, x_at, str + i);
+    x_at += glyph_data->advance;
+
+    i += match_length;
+  }
+}
+
+void Font::print(int x_start, int y_start, display::Display *display, Color color, const char *text, Color background) {
+  if (this->cache_size_ != 0) {
+    const RenderedText &rendered = this->get_rendered_text_(text);
+    display->draw_alpha_bitmap_at(x_start + rendered.x_offset, y_start + rendered.y_offset, rendered.width,
+                                  rendered.height, rendered.data.data(), this->bpp_, color, background);
+    return;
+  }
+
+  for_each_glyph(this, text, [&](const GlyphData *glyph_data, int x_at, const char *str) {
+    if (glyph_data == nullptr) {
+      ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", *str);
       if (!this->get_glyphs().empty()) {
         uint8_t glyph_width = this->get_glyphs()[0].glyph_data_->advance;
-        display->filled_rectangle(x_at, y_start, glyph_width, this->height_, color);
-        x_at += glyph_width;
+        display->filled_rectangle(x_start + x_at, y_start, glyph_width, this->height_, color);
       }
+      return;
+    }
+    display->draw_alpha_bitmap_at(x_start + x_at + glyph_data->offset_x, y_start + glyph_data->offset_y,
+                                  glyph_data->width, glyph_data->height, glyph_data->data, this->bpp_, color,
+                                  background);
+  });
+}
 
-      i++;
-      continue;
+const Font::RenderedText &Font::get_rendered_text_(const char *text) {
+  for (auto &entry : this->cache_) {
+    if (entry.text == text) {
+      entry.last_used = ++this->cache_counter_;
+      return entry;
     }
+  }
 
-    const Glyph &glyph = this->get_glyphs()[glyph_n];
-    glyph.scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
+  RenderedText *entry;
+  if (this->cache_.size() < this->cache_size_) {
+    this->cache_.emplace_back();
+    entry = &this->cache_.back();
+  } else {
+    entry = &*std::min_element(this->cache_.begin(), this->cache_.end(),
+                               [](const RenderedText &a, const RenderedText &b) { return a.last_used < b.last_used; });
+  }
+  entry->text = text;
+  entry->last_used = ++this->cache_counter_;
 
-    const uint8_t *data = glyph.glyph_data_->data;
-    const int max_x = x_at + scan_x1 + scan_width;
-    const int max_y = y_start + scan_y1 + scan_height;
+  // first pass: bounding box of all glyphs, missing characters are drawn as filled rectangles
+  const int missing_width = this->glyphs_.empty() ? 0 : this->glyphs_[0].glyph_data_->advance;
+  int min_x = INT_MAX, min_y = INT_MAX, max_x = INT_MIN, max_y = INT_MIN;
+  for_each_glyph(this, text, [&](const GlyphData *glyph_data, int x_at, const char *str) {
+    int x1 = x_at, y1 = 0, width = missing_width, height = this->height_;
+    if (glyph_data != nullptr) {
+      x1 += glyph_data->offset_x;
+      y1 = glyph_data->offset_y;
+      width = glyph_data->width;
+      height = glyph_data->height;
+    } else {
+      ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", *str);
+    }
+    if (width <= 0 || height <= 0)
+      return;
+    min_x = std::min(min_x, x1);
+    min_y = std::min(min_y, y1);
+    max_x = std::max(max_x, x1 + width);
+    max_y = std::max(max_y, y1 + height);
+  });
+  if (min_x >= max_x) {
+    entry->x_offset = entry->y_offset = entry->width = entry->height = 0;
+    entry->data.clear();
+    return *entry;
+  }
+  entry->x_offset = min_x;
+  entry->y_offset = min_y;
+  entry->width = max_x - min_x;
+  entry->height = max_y - min_y;
+  entry->data.assign((entry->width * entry->height * this->bpp_ + 7) / 8, 0);
 
-    uint8_t bitmask = 0;
+  // second pass: draw the glyphs, like print() later glyphs overwrite overlapping pixels
+  const uint8_t bpp = this->bpp_;
+  const uint8_t bpp_max = (1 << bpp) - 1;
+  uint8_t *data = entry->data.data();
+  auto set_pixel = [&](int x, int y, uint8_t pixel) {
+    const uint32_t pos = ((y - min_y) * entry->width + (x - min_x)) * bpp;
+    const uint8_t shift = 8 - bpp - pos % 8;
+    data[pos / 8] = (data[pos / 8] & ~(bpp_max << shift)) | (pixel << shift);
+  };
+  for_each_glyph(this, text, [&](const GlyphData *glyph_data, int x_at, const char *str) {
+    if (glyph_data == nullptr) {
+      for (int y = 0; y != this->height_; y++) {
+        for (int x = x_at; x != x_at + missing_width; x++)
+          set_pixel(x, y, bpp_max);
+      }
+      return;
+    }
+    const uint8_t *glyph_pixels = glyph_data->data;
     uint8_t pixel_data = 0;
-    uint8_t bpp_max = (1 << this->bpp_) - 1;
-    auto diff_r = (float) color.r - (float) background.r;
-    auto diff_g = (float) color.g - (float) background.g;
-    auto diff_b = (float) color.b - (float) background.b;
-    auto diff_w = (float) color.w - (float) background.w;
-    auto b_r = (float) background.r;
-    auto b_g = (float) background.g;
-    auto b_b = (float) background.b;
-    auto b_w = (float) background.w;
-    for (int glyph_y = y_start + scan_y1; glyph_y != max_y; glyph_y++) {
-      for (int glyph_x = x_at + scan_x1; glyph_x != max_x; glyph_x++) {
-        uint8_t pixel = 0;
-        for (int bit_num = 0; bit_num != this->bpp_; bit_num++) {
-          if (bitmask == 0) {
-            pixel_data = progmem_read_byte(data++);
-            bitmask = 0x80;
-          }
-          pixel <<= 1;
-          if ((pixel_data & bitmask) != 0)
-            pixel |= 1;
-          bitmask >>= 1;
-        }
-        if (pixel == bpp_max) {
-          display->draw_pixel_at(glyph_x, glyph_y, color);
-        } else if (pixel != 0) {
-          auto on = (float) pixel / (float) bpp_max;
-          auto blended = Color((uint8_t) (diff_r * on + b_r), (uint8_t) (diff_g * on + b_g),
-                               (uint8_t) (diff_b * on + b_b), (uint8_t) (diff_w * on + b_w));
-          display->draw_pixel_at(glyph_x, glyph_y, blended);
+    uint8_t shift = 0;
+    for (int y = glyph_data->offset_y; y != glyph_data->offset_y + glyph_data->height; y++) {
+      for (int x = x_at + glyph_data->offset_x; x != x_at + glyph_data->offset_x + glyph_data->width; x++) {
+        if (shift == 0) {
+          pixel_data = progmem_read_byte(glyph_pixels++);
+          shift = 8;
         }
+        shift -= bpp;
+        const uint8_t pixel = (pixel_data >> shift) & bpp_max;
+        if (pixel != 0)
+          set_pixel(x, y, pixel);
       }
     }
-    x_at += glyph.glyph_data_->advance;
-
-    i += match_length;
-  }
+  });
+  return *entry;
 }
 #endif
 
@@ -63,6 +63,14 @@ class Font
              Color background) override;
   void measure(const char *str, int *width, int *x_offset, int *baseline, int *height) override;
 #endif
+
+  /** Keep the rendered bitmaps of the last cache_size printed texts.
+   *
+   * Labels that are redrawn every frame with unchanged text are then drawn with a single bitmap instead of looking
+   * up and drawing every glyph again. Defaults to 0 (disabled).
+   */
+  void set_cache_size(uint8_t cache_size) { this->cache_size_ = cache_size; }
+
   inline int get_baseline() { return this->baseline_; }
   inline int get_height() { return this->height_; }
   inline int get_bpp() { return this->bpp_; }
@@ -70,10 +78,31 @@ class Font
   const std::vector<Glyph, ExternalRAMAllocator<Glyph>> &get_glyphs() const { return glyphs_; }
 
  protected:
+#ifdef USE_DISPLAY
+  /// A text rendered into a single alpha bitmap with the bpp of this font, positioned relative to the print position.
+  struct RenderedText {
+    std::string text;
+    int x_offset;
+    int y_offset;
+    int width;
+    int height;
+    std::vector<uint8_t, ExternalRAMAllocator<uint8_t>> data;
+    uint32_t last_used;
+  };
+
+  /// Get text from the cache, rendering it into the least recently used entry if it is not cached yet.
+  const RenderedText &get_rendered_text_(const char *text);
+#endif
+
   std::vector<Glyph, ExternalRAMAllocator<Glyph>> glyphs_;
   int baseline_;
   int height_;
   uint8_t bpp_;  // bits per pixel
+  uint8_t cache_size_{0};
+#ifdef USE_DISPLAY
+  uint32_t cache_counter_{0};
+  std::vector<RenderedText> cache_;
+#endif
 };
 
 }  // namespace font
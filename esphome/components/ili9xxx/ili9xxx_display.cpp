@@ -57,10 +57,7 @@ void ILI9XXXDisplay::setup() {
 
   this->set_madctl();
   this->command(this->pre_invertcolors_ ? ILI9XXX_INVON : ILI9XXX_INVOFF);
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
+  this->dirty_regions_.clear();
 }
 
 void ILI9XXXDisplay::alloc_buffer_() {
@@ -129,10 +126,8 @@ void ILI9XXXDisplay::fill(Color color) {
   if (!this->check_buffer_())
     return;
   uint16_t new_color = 0;
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
+  this->dirty_regions_.clear();
+  this->dirty_regions_.add(0, 0, this->get_width_internal(), this->get_height_internal());
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
       new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
@@ -192,18 +187,128 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
     updated = true;
   }
   if (updated) {
-    // low and high watermark may speed up drawing from buffer
-    if (x < this->x_low_)
-      this->x_low_ = x;
-    if (y < this->y_low_)
-      this->y_low_ = y;
-    if (x > this->x_high_)
-      this->x_high_ = x;
-    if (y > this->y_high_)
-      this->y_high_ = y;
+    // tracking the changed regions may speed up drawing from buffer
+    this->dirty_regions_.add(x, y);
   }
 }
 
+uint16_t ILI9XXXDisplay::to_buffer_color_(Color color) {
+  switch (this->buffer_color_mode_) {
+    case BITS_8_INDEXED:
+      return display::ColorUtil::color_to_index8_palette888(color, this->palette_);
+    case BITS_16:
+      return display::ColorUtil::color_to_565(color, display::ColorOrder::COLOR_ORDER_RGB);
+    default:
+      return display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+  }
+}
+
+bool HOT ILI9XXXDisplay::fill_row_(int x, int y, int width, uint16_t buffer_color, int &low, int &high) {
+  const uint8_t hi_byte = buffer_color >> 8;
+  const uint8_t lo_byte = buffer_color;
+  low = x + width;
+  high = -1;
+  if (this->buffer_color_mode_ == BITS_16) {
+    uint8_t *ptr = this->buffer_ + (y * this->width_ + x) * 2;
+    for (int i = x; i != x + width; i++, ptr += 2) {
+      if (ptr[0] != hi_byte || ptr[1] != lo_byte) {
+        ptr[0] = hi_byte;
+        ptr[1] = lo_byte;
+        low = std::min(low, i);
+        high = i;
+      }
+    }
+  } else {
+    uint8_t *ptr = this->buffer_ + y * this->width_ + x;
+    for (int i = x; i != x + width; i++, ptr++) {
+      if (*ptr != lo_byte) {
+        *ptr = lo_byte;
+        low = std::min(low, i);
+        high = i;
+      }
+    }
+  }
+  return high >= 0;
+}
+
+void HOT ILI9XXXDisplay::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  if (!this->check_buffer_())
+    return;
+  const uint16_t new_color = this->to_buffer_color_(color);
+
+  // track the area actually changed, so the dirty regions stay as tight as with single pixel writes
+  int x_low = x + width;
+  int x_high = -1;
+  int y_low = y + height;
+  int y_high = -1;
+  for (int j = y; j != y + height; j++) {
+    int row_low, row_high;
+    if (this->fill_row_(x, j, width, new_color, row_low, row_high)) {
+      x_low = std::min(x_low, row_low);
+      x_high = std::max(x_high, row_high);
+      y_low = std::min(y_low, j);
+      y_high = j;
+    }
+  }
+  if (x_high >= 0)
+    this->dirty_regions_.add(x_low, y_low, x_high - x_low + 1, y_high - y_low + 1);
+}
+
+void HOT ILI9XXXDisplay::draw_absolute_alpha_bitmap_internal(int x, int y, int width, int height, const uint8_t *data,
+                                                             uint8_t bpp, Color color, Color background) {
+  if (!this->check_buffer_())
+    return;
+  // blending and converting is the expensive part, so it is done once per pixel value for fonts of up to 4 bpp
+  uint16_t colors[16];
+  uint16_t converted = 0;
+  int x_low = x + width;
+  int x_high = -1;
+  int y_low = y + height;
+  int y_high = -1;
+  decode_alpha_bitmap_(x, y, width, height, data, bpp, [&](int run_x, int run_y, int length, uint8_t pixel) {
+    uint16_t new_color;
+    if (pixel >= 16) {
+      new_color = this->to_buffer_color_(blend_alpha_(pixel, bpp, color, background));
+    } else {
+      if ((converted & (1 << pixel)) == 0) {
+        colors[pixel] = this->to_buffer_color_(blend_alpha_(pixel, bpp, color, background));
+        converted |= 1 << pixel;
+      }
+      new_color = colors[pixel];
+    }
+    int row_low, row_high;
+    if (this->fill_row_(run_x, run_y, length, new_color, row_low, row_high)) {
+      x_low = std::min(x_low, row_low);
+      x_high = std::max(x_high, row_high);
+      y_low = std::min(y_low, run_y);
+      y_high = run_y;
+    }
+  });
+  if (x_high >= 0)
+    this->dirty_regions_.add(x_low, y_low, x_high - x_low + 1, y_high - y_low + 1);
+}
+
+void HOT ILI9XXXDisplay::draw_absolute_rgb565_internal(int x, int y, int width, int height, const uint8_t *data,
+                                                       size_t stride) {
+  if (this->buffer_color_mode_ != BITS_16) {
+    display::DisplayBuffer::draw_absolute_rgb565_internal(x, y, width, height, data, stride);
+    return;
+  }
+  if (!this->check_buffer_())
+    return;
+  // the buffer holds the same big-endian RGB565 format, so whole rows can be copied
+  int y_low = y + height;
+  int y_high = -1;
+  for (int j = y; j != y + height; j++, data += stride) {
+    if (copy_row_(this->buffer_ + (j * this->width_ + x) * 2, data, width * 2)) {
+      y_low = std::min(y_low, j);
+      y_high = j;
+    }
+  }
+  if (y_high >= 0)
+    this->dirty_regions_.add(x, y_low, width, y_high - y_low + 1);
+}
+
 void ILI9XXXDisplay::update() {
   if (this->prossing_update_) {
     this->need_update_ = true;
@@ -219,14 +324,19 @@ void ILI9XXXDisplay::update() {
 }
 
 void ILI9XXXDisplay::display_() {
-  // check if something was displayed
-  if ((this->x_high_ < this->x_low_) || (this->y_high_ < this->y_low_)) {
-    return;
-  }
+  // we will only update the changed regions of the display, each with its own address window
+  for (const auto &region : this->dirty_regions_)
+    this->display_region_(region);
+  this->dirty_regions_.clear();
+}
 
-  // we will only update the changed rows to the display
-  size_t const w = this->x_high_ - this->x_low_ + 1;
-  size_t const h = this->y_high_ - this->y_low_ + 1;
+void ILI9XXXDisplay::display_region_(const display::Rect &region) {
+  size_t const x_low = region.x;
+  size_t const y_low = region.y;
+  size_t const x_high = region.x2() - 1;
+  size_t const y_high = region.y2() - 1;
+  size_t const w = region.w;
+  size_t const h = region.h;
 
   size_t mhz = this->data_rate_ / 1000000;
   // estimate time for a single write
@@ -234,24 +344,23 @@ void ILI9XXXDisplay::display_() {
   // estimate time for multiple writes
   size_t mw_time = (w * h * 16) / mhz + w * h * 2 / ILI9XXX_TRANSFER_BUFFER_SIZE * SPI_SETUP_US;
   ESP_LOGV(TAG,
-           "Start display(xlow:%d, ylow:%d, xhigh:%d, yhigh:%d, width:%d, "
+           "Start display(xlow:%zu, ylow:%zu, xhigh:%zu, yhigh:%zu, width:%zu, "
            "height:%zu, mode=%d, 18bit=%d, sw_time=%zuus, mw_time=%zuus)",
-           this->x_low_, this->y_low_, this->x_high_, this->y_high_, w, h, this->buffer_color_mode_,
-           this->is_18bitdisplay_, sw_time, mw_time);
+           x_low, y_low, x_high, y_high, w, h, this->buffer_color_mode_, this->is_18bitdisplay_, sw_time, mw_time);
   auto now = millis();
   if (this->buffer_color_mode_ == BITS_16 && !this->is_18bitdisplay_ && sw_time < mw_time) {
     // 16 bit mode maps directly to display format
     ESP_LOGV(TAG, "Doing single write of %zu bytes", this->width_ * h * 2);
-    set_addr_window_(0, this->y_low_, this->width_ - 1, this->y_high_);
-    this->write_array(this->buffer_ + this->y_low_ * this->width_ * 2, h * this->width_ * 2);
+    set_addr_window_(0, y_low, this->width_ - 1, y_high);
+    this->write_array(this->buffer_ + y_low * this->width_ * 2, h * this->width_ * 2);
   } else {
     ESP_LOGV(TAG, "Doing multiple write");
     uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
     size_t rem = h * w;  // remaining number of pixels to write
-    set_addr_window_(this->x_low_, this->y_low_, this->x_high_, this->y_high_);
+    set_addr_window_(x_low, y_low, x_high, y_high);
     size_t idx = 0;    // index into transfer_buffer
     size_t pixel = 0;  // pixel number offset
-    size_t pos = this->y_low_ * this->width_ + this->x_low_;
+    size_t pos = y_low * this->width_ + x_low;
     while (rem-- != 0) {
       uint16_t color_val;
       switch (this->buffer_color_mode_) {
@@ -293,11 +402,6 @@ void ILI9XXXDisplay::display_() {
   }
   this->end_data_();
   ESP_LOGV(TAG, "Data write took %dms", (unsigned) (millis() - now));
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
 }
 
 // note that this bypasses the buffer and writes directly to the display.
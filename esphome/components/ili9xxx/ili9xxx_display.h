@@ -2,6 +2,7 @@
 #include "esphome/components/spi/spi.h"
 #include "esphome/components/display/display_buffer.h"
 #include "esphome/components/display/display_color_utils.h"
+#include "esphome/components/display/dirty_regions.h"
 #include "ili9xxx_defines.h"
 #include "ili9xxx_init.h"
 
@@ -106,10 +107,21 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   }
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x, int y, int width, int height, Color color) override;
+  void draw_absolute_rgb565_internal(int x, int y, int width, int height, const uint8_t *data, size_t stride) override;
+  void draw_absolute_alpha_bitmap_internal(int x, int y, int width, int height, const uint8_t *data, uint8_t bpp,
+                                           Color color, Color background) override;
+  /// Convert color to the format of the buffer, as written by fill_row_().
+  uint16_t to_buffer_color_(Color color);
+  /** Fill width pixels of row y from column x with buffer_color. Returns whether any pixel changed, and the first
+   * and last changed column in low and high.
+   */
+  bool fill_row_(int x, int y, int width, uint16_t buffer_color, int &low, int &high);
   void setup_pins_();
 
   virtual void set_madctl();
   void display_();
+  void display_region_(const display::Rect &region);
   void init_lcd_(const uint8_t *addr);
   void set_addr_window_(uint16_t x, uint16_t y, uint16_t x2, uint16_t y2);
   void reset_();
@@ -120,10 +132,7 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   int16_t height_{0};  ///< Display height as modified by current rotation
   int16_t offset_x_{0};
   int16_t offset_y_{0};
-  uint16_t x_low_{0};
-  uint16_t y_low_{0};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
+  display::DirtyRegions dirty_regions_{};
   const uint8_t *palette_{};
 
   ILI9XXXColorMode buffer_color_mode_{BITS_16};
@@ -38,6 +38,8 @@ CONF_OPAQUE = "opaque"
 CONF_CHROMA_KEY = "chroma_key"
 CONF_ALPHA_CHANNEL = "alpha_channel"
 CONF_INVERT_ALPHA = "invert_alpha"
+CONF_NATIVE_FORMAT = "native_format"
+CONF_RUN_MASK_ID = "run_mask_id"
 
 TRANSPARENCY_TYPES = (
     CONF_OPAQUE,
@@ -198,6 +200,8 @@ class ImageRGB565(ImageEncoder):
         g = g >> 2
         b = b >> 3
         if self.transparency == CONF_CHROMA_KEY:
+            if self.invert_alpha:
+                a ^= 0xFF
             if r == 0 and g == 1 and b == 0:
                 g = 0
             elif a < 128:
@@ -428,6 +432,8 @@ def validate_settings(value):
         and CONF_INVERT_ALPHA not in allow_config
     ):
         raise cv.Invalid("No alpha channel to invert")
+    if value.get(CONF_NATIVE_FORMAT) and type != "RGB565":
+        raise cv.Invalid(f"{CONF_NATIVE_FORMAT} is only supported for RGB565 images")
     if file := value.get(CONF_FILE):
         file = Path(file)
         if is_svg_file(file):
@@ -449,7 +455,9 @@ BASE_SCHEMA = cv.Schema(
             "NONE", "FLOYDSTEINBERG", upper=True
         ),
         cv.Optional(CONF_INVERT_ALPHA, default=False): cv.boolean,
+        cv.Optional(CONF_NATIVE_FORMAT, default=False): cv.boolean,
         cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
+        cv.GenerateID(CONF_RUN_MASK_ID): cv.declare_id(cg.uint8),
     }
 ).add_extra(validate_settings)
 
@@ -509,6 +517,39 @@ CONFIG_SCHEMA = cv.Any(
 )
 
 
+def encode_run_mask(data, width, height, frame_count):
+    """
+    Encode the opaque pixels of a chroma keyed RGB565 image as runs, so they can be drawn
+    without looking at each pixel.
+    The mask starts with a little-endian uint32 offset for each frame, followed by the
+    alternating lengths of transparent and opaque runs of every row, each at most 255.
+    A row ends as soon as its runs cover the image width.
+    """
+    header = []
+    runs = []
+    offset = frame_count * 4
+    for frame in range(frame_count):
+        header.extend((offset + len(runs)).to_bytes(4, "little"))
+        for row in range(frame * height, (frame + 1) * height):
+            pixels = data[row * width * 2 : (row + 1) * width * 2]
+            opaque = [
+                pixels[i * 2] != 0x00 or pixels[i * 2 + 1] != 0x20
+                for i in range(width)
+            ]
+            pos = 0
+            while pos < width:
+                for want_opaque in (False, True):
+                    start = pos
+                    while pos < width and pos - start < 255:
+                        if opaque[pos] != want_opaque:
+                            break
+                        pos += 1
+                    runs.append(pos - start)
+                    if pos == width:
+                        break
+    return header + runs
+
+
 async def write_image(config, all_frames=False):
     path = Path(config[CONF_FILE])
     if not path.is_file():
@@ -554,6 +595,11 @@ async def write_image(config, all_frames=False):
     type = config[CONF_TYPE]
     transparency = config[CONF_TRANSPARENCY]
     invert_alpha = config[CONF_INVERT_ALPHA]
+    native_format = config.get(CONF_NATIVE_FORMAT, False)
+    if native_format and transparency == CONF_ALPHA_CHANNEL:
+        # Keep the pixels in the 2 byte format of the display buffer, the alpha channel
+        # is reduced to the same threshold used when drawing.
+        transparency = CONF_CHROMA_KEY
     frame_count = 1
     if all_frames:
         try:
@@ -575,12 +621,23 @@ async def write_image(config, all_frames=False):
 
     rhs = [HexInt(x) for x in encoder.data]
     prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
+    if native_format and transparency != CONF_OPAQUE:
+        run_mask = encode_run_mask(encoder.data, width, height, frame_count)
+        cg.progmem_array(config[CONF_RUN_MASK_ID], [HexInt(x) for x in run_mask])
     image_type = get_image_type_enum(type)
     trans_value = get_transparency_enum(encoder.transparency)
 
     return prog_arr, width, height, image_type, trans_value, frame_count
 
 
+async def run_mask_to_code(var, config):
+    """
+    Attach the run mask generated by write_image(), if any, to the image variable.
+    """
+    if config.get(CONF_NATIVE_FORMAT) and config[CONF_TRANSPARENCY] != CONF_OPAQUE:
+        cg.add(var.set_run_mask(await cg.get_variable(config[CONF_RUN_MASK_ID])))
+
+
 async def to_code(config):
     if isinstance(config, list):
         for entry in config:
@@ -590,6 +647,7 @@ async def to_code(config):
             await to_code(entry)
     else:
         prog_arr, width, height, image_type, trans_value, _ = await write_image(config)
-        cg.new_Pvariable(
+        var = cg.new_Pvariable(
             config[CONF_ID], prog_arr, width, height, image_type, trans_value
         )
+        await run_mask_to_code(var, config)
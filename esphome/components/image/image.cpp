@@ -47,19 +47,59 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       }
       break;
     case IMAGE_TYPE_RGB565:
+      this->draw_rgb565_(x, y, display);
+      break;
+    case IMAGE_TYPE_RGB:
       for (int img_x = 0; img_x < width_; img_x++) {
         for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb565_pixel_(img_x, img_y);
+          auto color = this->get_rgb_pixel_(img_x, img_y);
           if (color.w >= 0x80) {
             display->draw_pixel_at(x + img_x, y + img_y, color);
           }
         }
       }
       break;
-    case IMAGE_TYPE_RGB:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb_pixel_(img_x, img_y);
+  }
+}
+void Image::draw_rgb565_(int x, int y, display::Display *display) {
+  const size_t stride = this->get_width_stride();
+  switch (this->transparency_) {
+    case TRANSPARENCY_OPAQUE:
+      display->draw_rgb565_at(x, y, this->width_, this->height_, this->data_start_, stride);
+      break;
+    case TRANSPARENCY_CHROMA_KEY: {
+      const uint8_t *row = this->data_start_;
+      const uint8_t *runs = this->run_mask_start_;
+      for (int img_y = 0; img_y != this->height_; img_y++, row += stride) {
+        int img_x = 0;
+        while (img_x != this->width_) {
+          int start;
+          if (runs != nullptr) {
+            // precomputed lengths of the transparent and following opaque run
+            img_x += progmem_read_byte(runs++);
+            if (img_x == this->width_)
+              break;
+            start = img_x;
+            img_x += progmem_read_byte(runs++);
+          } else {
+            while (img_x != this->width_ && progmem_read_byte(row + img_x * 2) == 0x00 &&
+                   progmem_read_byte(row + img_x * 2 + 1) == 0x20)
+              img_x++;
+            start = img_x;
+            while (img_x != this->width_ &&
+                   (progmem_read_byte(row + img_x * 2) != 0x00 || progmem_read_byte(row + img_x * 2 + 1) != 0x20))
+              img_x++;
+          }
+          if (img_x != start)
+            display->draw_rgb565_at(x + start, y + img_y, img_x - start, 1, row + start * 2, stride);
+        }
+      }
+      break;
+    }
+    default:
+      for (int img_y = 0; img_y < height_; img_y++) {
+        for (int img_x = 0; img_x < width_; img_x++) {
+          auto color = this->get_rgb565_pixel_(img_x, img_y);
           if (color.w >= 0x80) {
             display->draw_pixel_at(x + img_x, y + img_y, color);
           }
@@ -68,6 +108,18 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       break;
   }
 }
+void Image::set_run_mask(const uint8_t *run_mask) {
+  this->run_mask_ = run_mask;
+  this->set_run_mask_frame_(0);
+}
+void Image::set_run_mask_frame_(uint32_t frame) {
+  if (this->run_mask_ == nullptr)
+    return;
+  const uint8_t *offset = this->run_mask_ + frame * 4;
+  this->run_mask_start_ =
+      this->run_mask_ + encode_uint32(progmem_read_byte(offset + 3), progmem_read_byte(offset + 2),
+                                      progmem_read_byte(offset + 1), progmem_read_byte(offset));
+}
 Color Image::get_pixel(int x, int y, const Color color_on, const Color color_off) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return color_off;
@@ -40,6 +40,12 @@ class Image : public display::BaseImage {
 
   bool has_transparency() const { return this->transparency_ != TRANSPARENCY_OPAQUE; }
 
+  /** Set the run-length mask of the opaque pixels of a chroma keyed RGB565 image, generated with native_format.
+   * It starts with a little-endian uint32 offset per frame, followed by the alternating lengths of transparent and
+   * opaque runs of every row. With the mask the runs are drawn without checking every pixel for the chroma key.
+   */
+  void set_run_mask(const uint8_t *run_mask);
+
 #ifdef USE_LVGL
   lv_img_dsc_t *get_lv_img_dsc();
 #endif
@@ -49,10 +55,17 @@ class Image : public display::BaseImage {
   Color get_rgb565_pixel_(int x, int y) const;
   Color get_grayscale_pixel_(int x, int y) const;
 
+  /// Draw an RGB565 image with whole rows or runs of opaque pixels at once.
+  void draw_rgb565_(int x, int y, display::Display *display);
+  /// Point run_mask_start_ to the runs of the given frame.
+  void set_run_mask_frame_(uint32_t frame);
+
   int width_;
   int height_;
   ImageType type_;
   const uint8_t *data_start_;
+  const uint8_t *run_mask_{nullptr};
+  const uint8_t *run_mask_start_{nullptr};
   Transparency transparency_;
   size_t bpp_{};
   size_t stride_{};
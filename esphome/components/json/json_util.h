@@ -10,6 +10,8 @@
 
 #include <ArduinoJson.h>
 
+#include "json_writer.h"
+
 namespace esphome {
 namespace json {
 
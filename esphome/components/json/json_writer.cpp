@@ -0,0 +1,166 @@
+#include "json_writer.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace esphome {
+namespace json {
+
+void JsonWriter::separator_() {
+  if (this->empty_levels_ & 1) {
+    this->empty_levels_ &= ~1u;
+  } else {
+    this->raw_(',');
+  }
+}
+
+void JsonWriter::key_(const char *key) {
+  this->separator_();
+  this->value_(key);
+  this->raw_(':');
+}
+
+JsonWriter &JsonWriter::begin_object() {
+  this->separator_();
+  this->raw_('{');
+  this->empty_levels_ = (this->empty_levels_ << 1) | 1;
+  return *this;
+}
+
+JsonWriter &JsonWriter::begin_object(const char *key) {
+  this->key_(key);
+  this->raw_('{');
+  this->empty_levels_ = (this->empty_levels_ << 1) | 1;
+  return *this;
+}
+
+JsonWriter &JsonWriter::end_object() {
+  this->raw_('}');
+  this->empty_levels_ >>= 1;
+  return *this;
+}
+
+JsonWriter &JsonWriter::begin_array() {
+  this->separator_();
+  this->raw_('[');
+  this->empty_levels_ = (this->empty_levels_ << 1) | 1;
+  return *this;
+}
+
+JsonWriter &JsonWriter::begin_array(const char *key) {
+  this->key_(key);
+  this->raw_('[');
+  this->empty_levels_ = (this->empty_levels_ << 1) | 1;
+  return *this;
+}
+
+JsonWriter &JsonWriter::end_array() {
+  this->raw_(']');
+  this->empty_levels_ >>= 1;
+  return *this;
+}
+
+void JsonWriter::value_(const char *value) {
+  if (value == nullptr) {
+    this->value_(nullptr);
+    return;
+  }
+  this->string_(value, strlen(value));
+}
+
+void JsonWriter::value_(bool value) {
+  if (value) {
+    this->raw_("true", 4);
+  } else {
+    this->raw_("false", 5);
+  }
+}
+
+void JsonWriter::value_(std::nullptr_t /*unused*/) { this->raw_("null", 4); }
+
+void JsonWriter::string_(const char *value, size_t len) {
+  static const char *const HEX_CHARS = "0123456789abcdef";
+  this->raw_('"');
+  // Write unescaped runs in one go, only the characters JSON requires are escaped
+  size_t run = 0;
+  for (size_t i = 0; i < len; i++) {
+    auto c = static_cast<uint8_t>(value[i]);
+    if (c >= 0x20 && c != '"' && c != '\\')
+      continue;
+    this->raw_(value + run, i - run);
+    run = i + 1;
+    char escape[6] = {'\\', 0, '0', '0', 0, 0};
+    switch (c) {
+      case '"':
+      case '\\':
+        escape[1] = static_cast<char>(c);
+        break;
+      case '\b':
+        escape[1] = 'b';
+        break;
+      case '\f':
+        escape[1] = 'f';
+        break;
+      case '\n':
+        escape[1] = 'n';
+        break;
+      case '\r':
+        escape[1] = 'r';
+        break;
+      case '\t':
+        escape[1] = 't';
+        break;
+      default:
+        escape[1] = 'u';
+        escape[4] = HEX_CHARS[c >> 4];
+        escape[5] = HEX_CHARS[c & 0xF];
+        this->raw_(escape, 6);
+        continue;
+    }
+    this->raw_(escape, 2);
+  }
+  this->raw_(value + run, len - run);
+  this->raw_('"');
+}
+
+void JsonWriter::integer_(bool negative, uint64_t value) {
+  char buf[21];
+  char *pos = buf + sizeof(buf);
+  do {
+    *--pos = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  if (negative)
+    *--pos = '-';
+  this->raw_(pos, buf + sizeof(buf) - pos);
+}
+
+void JsonWriter::float_(double value, int precision) {
+  // JSON has no representation for NaN and infinity
+  if (!std::isfinite(value)) {
+    this->value_(nullptr);
+    return;
+  }
+  char buf[32];
+  int len = snprintf(buf, sizeof(buf), "%.*g", precision, value);
+  this->raw_(buf, len);
+}
+
+std::string write_json(const json_write_t &f) {
+  std::string output;
+  write_json(output, f);
+  return output;
+}
+
+void write_json(std::string &output, const json_write_t &f) {
+  output.clear();
+  StringJsonSink sink(output);
+  JsonWriter writer(sink);
+  writer.begin_object();
+  f(writer);
+  writer.end_object();
+}
+
+}  // namespace json
+}  // namespace esphome
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace esphome {
+namespace json {
+
+/// Destination of the bytes produced by a JsonWriter.
+class JsonSink {
+ public:
+  virtual ~JsonSink() = default;
+  virtual void write(const char *data, size_t len) = 0;
+};
+
+/// Appends the JSON text to a string, which can be reused between documents to avoid reallocations.
+class StringJsonSink : public JsonSink {
+ public:
+  explicit StringJsonSink(std::string &output) : output_(output) {}
+  void write(const char *data, size_t len) override { this->output_.append(data, len); }
+
+ protected:
+  std::string &output_;
+};
+
+/** Writes JSON text directly into a JsonSink, without building a document in memory first.
+ *
+ * Keys and values are emitted in the order they are added, so every key must be written once and nested objects and
+ * arrays must be closed before continuing with their parent:
+ *
+ * @code
+ * root.add("id", "sensor-temperature");
+ * root.begin_object("color");
+ * root.add("r", 255);
+ * root.end_object();
+ * root.begin_array("effects");
+ * root.add("None");
+ * root.end_array();
+ * @endcode
+ */
+class JsonWriter {
+ public:
+  explicit JsonWriter(JsonSink &sink) : sink_(sink) {}
+
+  JsonWriter &begin_object();
+  JsonWriter &begin_object(const char *key);
+  JsonWriter &end_object();
+  JsonWriter &begin_array();
+  JsonWriter &begin_array(const char *key);
+  JsonWriter &end_array();
+
+  /// Add a member to the current object.
+  template<typename T> JsonWriter &add(const char *key, const T &value) {
+    this->key_(key);
+    this->value_(value);
+    return *this;
+  }
+  template<typename T> JsonWriter &add(const std::string &key, const T &value) { return this->add(key.c_str(), value); }
+  /// Add an element to the current array.
+  template<typename T> JsonWriter &add(const T &value) {
+    this->separator_();
+    this->value_(value);
+    return *this;
+  }
+
+ protected:
+  void separator_();
+  void key_(const char *key);
+  void raw_(const char *data, size_t len) { this->sink_.write(data, len); }
+  void raw_(char c) { this->sink_.write(&c, 1); }
+
+  void value_(const char *value);
+  /// Anything string-like, such as std::string and StringRef.
+  template<typename T, typename = decltype(std::declval<const T &>().c_str(), std::declval<const T &>().size())>
+  void value_(const T &value) {
+    this->string_(value.c_str(), value.size());
+  }
+  template<size_t N> void value_(const char (&value)[N]) { this->value_(static_cast<const char *>(value)); }
+  void value_(bool value);
+  void value_(std::nullptr_t /*unused*/);
+  // Enough significant digits for the value to read back unchanged
+  void value_(float value) { this->float_(value, 9); }
+  void value_(double value) { this->float_(value, 15); }
+  template<typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+  void value_(T value) {
+    this->integer_(value < 0, value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value));
+  }
+  template<typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value &&
+                                                   !std::is_same<T, bool>::value,
+                                               int>::type = 0>
+  void value_(T value) {
+    this->integer_(false, value);
+  }
+  template<typename T, typename std::enable_if<std::is_enum<T>::value, int>::type = 0> void value_(T value) {
+    this->value_(static_cast<typename std::underlying_type<T>::type>(value));
+  }
+
+  void string_(const char *value, size_t len);
+  void integer_(bool negative, uint64_t value);
+  void float_(double value, int precision);
+
+  JsonSink &sink_;
+  /// One bit per nesting level, set while that level has no members yet.
+  uint32_t empty_levels_{1};
+};
+
+/// Callback function typedef for writing JSON documents.
+using json_write_t = std::function<void(JsonWriter &)>;
+
+/// Write the JSON object produced by the provided function into a string.
+std::string write_json(const json_write_t &f);
+/// Write the JSON object produced by the provided function into output, replacing its content.
+void write_json(std::string &output, const json_write_t &f);
+
+}  // namespace json
+}  // namespace esphome
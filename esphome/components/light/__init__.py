@@ -60,6 +60,8 @@ from .types import (  # noqa
 CODEOWNERS = ["@esphome/core"]
 IS_PLATFORM_COMPONENT = True
 
+CONF_FRAME_RATE = "frame_rate"
+
 LightRestoreMode = light_ns.enum("LightRestoreMode")
 RESTORE_MODES = {
     "RESTORE_DEFAULT_OFF": LightRestoreMode.LIGHT_RESTORE_DEFAULT_OFF,
@@ -137,6 +139,9 @@ ADDRESSABLE_LIGHT_SCHEMA = RGB_LIGHT_SCHEMA.extend(
             [cv.percentage], cv.Length(min=3, max=4)
         ),
         cv.Optional(CONF_POWER_SUPPLY): cv.use_id(power_supply.PowerSupply),
+        cv.Optional(CONF_FRAME_RATE): cv.All(
+            cv.framerate, cv.Range(min=0, min_included=False, max=1000)
+        ),
     }
 )
 
@@ -208,6 +213,9 @@ async def setup_light_core_(light_var, output_var, config):
         var_ = await cg.get_variable(power_supply_id)
         cg.add(output_var.set_power_supply(var_))
 
+    if (frame_rate := config.get(CONF_FRAME_RATE)) is not None:
+        cg.add(light_var.set_frame_interval(int(1000000 / frame_rate)))
+
     if (mqtt_id := config.get(CONF_MQTT_ID)) is not None:
         mqtt_ = cg.new_Pvariable(mqtt_id, light_var)
         await mqtt.register_mqtt_component(mqtt_, config)
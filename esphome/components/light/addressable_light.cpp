@@ -35,6 +35,52 @@ Color color_from_light_color_values(LightColorValues val) {
   return Color(r, g, b, w);
 }
 
+void AddressableLightState::setup() {
+  LightState::setup();
+  this->next_frame_ = micros();
+}
+
+void AddressableLightState::loop() {
+  if (this->frame_interval_ == 0) {
+    LightState::loop();
+    return;
+  }
+
+  const uint32_t now = micros();
+  if (static_cast<int32_t>(now - this->next_frame_) < 0)
+    return;
+  if (this->get_active_effect_() != nullptr || this->transformer_ != nullptr || this->next_write_) {
+    // frames that were due while the main loop was busy are dropped, rendering continues on the same frame grid
+    const uint32_t missed = (now - this->next_frame_) / this->frame_interval_;
+    this->dropped_frame_count_ += missed;
+    this->next_frame_ += (missed + 1) * this->frame_interval_;
+  } else {
+    this->next_frame_ = now + this->frame_interval_;
+  }
+  LightState::loop();
+}
+
+void AddressableLightState::write_output_() {
+  if (this->frame_interval_ != 0) {
+    // skip frames that are identical to the last one written
+    uint32_t hash = 2166136261UL;
+    for (auto view : *static_cast<AddressableLight *>(this->output_))
+      hash = (hash ^ view.get_raw().raw_32) * 16777619UL;
+    if (this->last_frame_valid_ && hash == this->last_frame_hash_)
+      return;
+    this->last_frame_hash_ = hash;
+    this->last_frame_valid_ = true;
+  }
+
+  LightState::write_output_();
+  if (this->next_write_) {
+    // the output postponed writing this frame, so it has to be written again even if it didn't change
+    this->last_frame_valid_ = false;
+  } else {
+    this->frame_count_++;
+  }
+}
+
 void AddressableLight::update_state(LightState *state) {
   auto val = state->current_values;
   auto max_brightness = to_uint8_scale(val.get_brightness() * val.get_state());
@@ -95,13 +141,8 @@ optional<LightColorValues> AddressableLightTransformer::apply() {
   alpha255 = clamp(alpha255, 0.0f, 255.0f);
   auto alpha8 = static_cast<uint8_t>(alpha255);
 
-  if (alpha8 != 0) {
-    uint8_t inv_alpha8 = 255 - alpha8;
-    Color add = this->target_color_ * alpha8;
-
-    for (auto led : this->light_)
-      led.set(add + led.get() * inv_alpha8);
-  }
+  if (alpha8 != 0)
+    this->light_.all().blend(this->target_color_, alpha8);
 
   this->last_transition_progress_ = smoothed_progress;
   this->light_.schedule_show();
@@ -25,7 +25,30 @@ Color color_from_light_color_values(LightColorValues val);
 /// Use a custom state class for addressable lights, to allow type system to discriminate between addressable and
 /// non-addressable lights.
 class AddressableLightState : public LightState {
+ public:
   using LightState::LightState;
+
+  void setup() override;
+  void loop() override;
+
+  /** Render effects and transitions at a fixed rate of one frame per interval (in µs), instead of every loop.
+   * Frames that are identical to the previous one aren't written to the output in this mode.
+   */
+  void set_frame_interval(uint32_t frame_interval) { this->frame_interval_ = frame_interval; }
+  /// Number of frames written to the output so far.
+  uint32_t get_frame_count() const { return this->frame_count_; }
+  /// Number of frames that weren't rendered because the main loop was busy when they were due.
+  uint32_t get_dropped_frame_count() const { return this->dropped_frame_count_; }
+
+ protected:
+  void write_output_() override;
+
+  uint32_t frame_interval_{0};
+  uint32_t next_frame_{0};
+  uint32_t frame_count_{0};
+  uint32_t dropped_frame_count_{0};
+  uint32_t last_frame_hash_{0};
+  bool last_frame_valid_{false};
 };
 
 class AddressableLight : public LightOutput, public Component {
@@ -83,6 +106,7 @@ class AddressableLight : public LightOutput, public Component {
 
  protected:
   friend class AddressableLightTransformer;
+  friend class ESPRangeView;
 
   void mark_shown_() {
 #ifdef USE_POWER_SUPPLY
@@ -99,6 +123,8 @@ class AddressableLight : public LightOutput, public Component {
 
   bool effect_active_{false};
   ESPColorCorrection correction_{};
+  /// Scratch table for ESPRangeView::map_(), only allocated once a range is large enough to use it.
+  uint8_t *range_lookup_{nullptr};
 #ifdef USE_POWER_SUPPLY
   power_supply::PowerSupplyRequester power_;
 #endif
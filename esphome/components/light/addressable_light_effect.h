@@ -306,8 +306,12 @@ class AddressableFireworksEffect : public AddressableLightEffect {
     }
     int last = it.size() - 1;
     it[0].set(it[0].get() + (it[1].get() * 128));
+    // the next LED isn't changed yet, so its color can be reused as the current color in the next iteration
+    Color color = it[1].get();
     for (int i = 1; i < last; i++) {
-      it[i] = (it[i - 1].get() * 64) + it[i].get() + (it[i + 1].get() * 64);
+      const Color next = it[i + 1].get();
+      it[i] = (it[i - 1].get() * 64) + color + (next * 64);
+      color = next;
     }
     it[last] = it[last].get() + (it[last - 1].get() * 128);
     if (random_float() < this->spark_probability_) {
@@ -344,15 +348,13 @@ class AddressableFlickerEffect : public AddressableLightEffect {
       return;
 
     this->last_update_ = now;
+    const Color add = current_color * intensity;
     uint32_t rng_state = random_uint32();
     for (auto var : it) {
       rng_state = (rng_state * 0x9E3779B9) + 0x9E37;
       const uint8_t flicker = (rng_state & 0xFF) % intensity;
-      // scale down by random factor
-      var = var.get() * (255 - flicker);
-
-      // slowly fade back to "real" value
-      var = (var.get() * inv_intensity) + (current_color * intensity);
+      // scale down by random factor, and slowly fade back to "real" value
+      var = (var.get() * (255 - flicker)) * inv_intensity + add;
     }
     it.schedule_show();
   }
@@ -14,13 +14,39 @@ void ESPColorCorrection::calculate_gamma_table(float gamma) {
   if (gamma == 0.0f) {
     for (uint16_t i = 0; i < 256; i++)
       this->gamma_reverse_table_[i] = i;
-    return;
+  } else {
+    for (uint16_t i = 0; i < 256; i++) {
+      // val = corrected ^ (1/gamma)
+      auto uncorrected = to_uint8_scale(powf(i / 255.0f, 1.0f / gamma));
+      this->gamma_reverse_table_[i] = uncorrected;
+    }
   }
+  this->invalidate_tables_();
+}
+
+void ESPColorCorrection::update_correct_table_(uint8_t channel) const {
+  const uint8_t max_brightness = this->max_brightness_.raw[channel];
+  for (uint16_t i = 0; i < 256; i++) {
+    // corrected = (uncorrected * max_brightness * local_brightness) ^ gamma
+    uint8_t res = esp_scale8(esp_scale8(i, max_brightness), this->local_brightness_);
+    this->correct_table_[channel][i] = this->gamma_table_[res];
+  }
+  this->correct_valid_ |= 1 << channel;
+}
+
+void ESPColorCorrection::update_uncorrect_table_(uint8_t channel) const {
+  const uint8_t max_brightness = this->max_brightness_.raw[channel];
   for (uint16_t i = 0; i < 256; i++) {
-    // val = corrected ^ (1/gamma)
-    auto uncorrected = to_uint8_scale(powf(i / 255.0f, 1.0f / gamma));
-    this->gamma_reverse_table_[i] = uncorrected;
+    // uncorrected = corrected^(1/gamma) / (max_brightness * local_brightness)
+    if (max_brightness == 0 || this->local_brightness_ == 0) {
+      this->uncorrect_table_[channel][i] = 0;
+      continue;
+    }
+    uint16_t uncorrected = this->gamma_reverse_table_[i] * 255UL;
+    uint16_t uncorrected_res = ((uncorrected / max_brightness) * 255UL) / this->local_brightness_;
+    this->uncorrect_table_[channel][i] = (uint8_t) std::min(uncorrected_res, uint16_t(255));
   }
+  this->uncorrect_valid_ |= 1 << channel;
 }
 
 }  // namespace light
@@ -8,29 +8,33 @@ namespace light {
 class ESPColorCorrection {
  public:
   ESPColorCorrection() : max_brightness_(255, 255, 255, 255) {}
-  void set_max_brightness(const Color &max_brightness) { this->max_brightness_ = max_brightness; }
-  void set_local_brightness(uint8_t local_brightness) { this->local_brightness_ = local_brightness; }
+  void set_max_brightness(const Color &max_brightness) {
+    if (max_brightness.raw_32 == this->max_brightness_.raw_32)
+      return;
+    this->max_brightness_ = max_brightness;
+    this->invalidate_tables_();
+  }
+  void set_local_brightness(uint8_t local_brightness) {
+    if (local_brightness == this->local_brightness_)
+      return;
+    this->local_brightness_ = local_brightness;
+    this->invalidate_tables_();
+  }
   void calculate_gamma_table(float gamma);
   inline Color color_correct(Color color) const ESPHOME_ALWAYS_INLINE {
     // corrected = (uncorrected * max_brightness * local_brightness) ^ gamma
     return Color(this->color_correct_red(color.red), this->color_correct_green(color.green),
                  this->color_correct_blue(color.blue), this->color_correct_white(color.white));
   }
-  inline uint8_t color_correct_red(uint8_t red) const ESPHOME_ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(red, this->max_brightness_.red), this->local_brightness_);
-    return this->gamma_table_[res];
-  }
+  inline uint8_t color_correct_red(uint8_t red) const ESPHOME_ALWAYS_INLINE { return this->get_correct_table_(0)[red]; }
   inline uint8_t color_correct_green(uint8_t green) const ESPHOME_ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(green, this->max_brightness_.green), this->local_brightness_);
-    return this->gamma_table_[res];
+    return this->get_correct_table_(1)[green];
   }
   inline uint8_t color_correct_blue(uint8_t blue) const ESPHOME_ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(blue, this->max_brightness_.blue), this->local_brightness_);
-    return this->gamma_table_[res];
+    return this->get_correct_table_(2)[blue];
   }
   inline uint8_t color_correct_white(uint8_t white) const ESPHOME_ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(white, this->max_brightness_.white), this->local_brightness_);
-    return this->gamma_table_[res];
+    return this->get_correct_table_(3)[white];
   }
   inline Color color_uncorrect(Color color) const ESPHOME_ALWAYS_INLINE {
     // uncorrected = corrected^(1/gamma) / (max_brightness * local_brightness)
@@ -38,37 +42,49 @@ class ESPColorCorrection {
                  this->color_uncorrect_blue(color.blue), this->color_uncorrect_white(color.white));
   }
   inline uint8_t color_uncorrect_red(uint8_t red) const ESPHOME_ALWAYS_INLINE {
-    if (this->max_brightness_.red == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[red] * 255UL;
-    uint16_t res = ((uncorrected / this->max_brightness_.red) * 255UL) / this->local_brightness_;
-    return (uint8_t) std::min(res, uint16_t(255));
+    return this->get_uncorrect_table_(0)[red];
   }
   inline uint8_t color_uncorrect_green(uint8_t green) const ESPHOME_ALWAYS_INLINE {
-    if (this->max_brightness_.green == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[green] * 255UL;
-    uint16_t res = ((uncorrected / this->max_brightness_.green) * 255UL) / this->local_brightness_;
-    return (uint8_t) std::min(res, uint16_t(255));
+    return this->get_uncorrect_table_(1)[green];
   }
   inline uint8_t color_uncorrect_blue(uint8_t blue) const ESPHOME_ALWAYS_INLINE {
-    if (this->max_brightness_.blue == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[blue] * 255UL;
-    uint16_t res = ((uncorrected / this->max_brightness_.blue) * 255UL) / this->local_brightness_;
-    return (uint8_t) std::min(res, uint16_t(255));
+    return this->get_uncorrect_table_(2)[blue];
   }
   inline uint8_t color_uncorrect_white(uint8_t white) const ESPHOME_ALWAYS_INLINE {
-    if (this->max_brightness_.white == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[white] * 255UL;
-    uint16_t res = ((uncorrected / this->max_brightness_.white) * 255UL) / this->local_brightness_;
-    return (uint8_t) std::min(res, uint16_t(255));
+    return this->get_uncorrect_table_(3)[white];
   }
 
  protected:
-  uint8_t gamma_table_[256];
-  uint8_t gamma_reverse_table_[256];
+  // The local brightness changes on every frame of a brightness transition, so the tables are only marked stale
+  // here and each channel is rebuilt the first time it is used afterwards.
+  void invalidate_tables_() {
+    this->correct_valid_ = 0;
+    this->uncorrect_valid_ = 0;
+  }
+  inline const uint8_t *get_correct_table_(uint8_t channel) const ESPHOME_ALWAYS_INLINE {
+    if (!(this->correct_valid_ & (1 << channel)))
+      this->update_correct_table_(channel);
+    return this->correct_table_[channel];
+  }
+  inline const uint8_t *get_uncorrect_table_(uint8_t channel) const ESPHOME_ALWAYS_INLINE {
+    if (!(this->uncorrect_valid_ & (1 << channel)))
+      this->update_uncorrect_table_(channel);
+    return this->uncorrect_table_[channel];
+  }
+  /// Recalculate the correction table of one channel from the gamma table and brightness levels.
+  void update_correct_table_(uint8_t channel) const;
+  /// Recalculate the uncorrection table of one channel from the reverse gamma table and brightness levels.
+  void update_uncorrect_table_(uint8_t channel) const;
+
+  uint8_t gamma_table_[256]{};
+  uint8_t gamma_reverse_table_[256]{};
+  /// Combined brightness and gamma correction for each channel, indexed by the uncorrected value.
+  mutable uint8_t correct_table_[4][256];
+  /// Inverse of correct_table_, indexed by the corrected value.
+  mutable uint8_t uncorrect_table_[4][256];
+  /// Bit mask of the channels whose tables are up to date.
+  mutable uint8_t correct_valid_{0};
+  mutable uint8_t uncorrect_valid_{0};
   Color max_brightness_;
   uint8_t local_brightness_{255};
 };
@@ -71,7 +71,18 @@ class ESPColorView : public ESPColorSettable {
   void fade_to_black(uint8_t amnt) override { this->set(this->get().fade_to_black(amnt)); }
   void lighten(uint8_t delta) override { this->set(this->get().lighten(delta)); }
   void darken(uint8_t delta) override { this->set(this->get().darken(delta)); }
+  /// Set the already corrected values of all channels, as returned by get_raw().
+  void set_raw(const Color &color) {
+    *this->red_ = color.red;
+    *this->green_ = color.green;
+    *this->blue_ = color.blue;
+    if (this->white_ != nullptr)
+      *this->white_ = color.white;
+  }
   Color get() const { return Color(this->get_red(), this->get_green(), this->get_blue(), this->get_white()); }
+  Color get_raw() const {
+    return Color(this->get_red_raw(), this->get_green_raw(), this->get_blue_raw(), this->get_white_raw());
+  }
   uint8_t get_red() const { return this->color_correction_->color_uncorrect_red(*this->red_); }
   uint8_t get_red_raw() const { return *this->red_; }
   uint8_t get_green() const { return this->color_correction_->color_uncorrect_green(*this->green_); }
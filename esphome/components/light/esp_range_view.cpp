@@ -1,9 +1,13 @@
 #include "esp_range_view.h"
 #include "addressable_light.h"
+#include "esphome/core/helpers.h"
 
 namespace esphome {
 namespace light {
 
+// Below this many LEDs, correcting every LED is cheaper than building the lookup table in ESPRangeView::map_()
+static const int32_t MIN_LOOKUP_LEDS = 256;
+
 int32_t HOT interpret_index(int32_t index, int32_t size) {
   if (index < 0)
     return size + index;
@@ -17,9 +21,38 @@ ESPColorView ESPRangeView::operator[](int32_t index) const {
 ESPRangeIterator ESPRangeView::begin() { return {*this, this->begin_}; }
 ESPRangeIterator ESPRangeView::end() { return {*this, this->end_}; }
 
+template<typename F> void ESPRangeView::map_(F &&op) {
+  if (this->size() >= MIN_LOOKUP_LEDS && this->parent_->range_lookup_ == nullptr) {
+    // 1 KiB is too much for the stack on the ESP8266, so the table is kept with the light once it is needed
+    RAMAllocator<uint8_t> allocator;
+    this->parent_->range_lookup_ = allocator.allocate(4 * 256);
+  }
+  uint8_t *lookup = this->parent_->range_lookup_;
+  if (this->size() < MIN_LOOKUP_LEDS || lookup == nullptr) {
+    for (auto c : *this)
+      c.set(op(c.get()));
+    return;
+  }
+
+  // As every channel only depends on its own value, the corrected result can be precomputed for every raw value
+  // of every channel, so that the LEDs themselves don't have to be uncorrected and corrected one by one.
+  const ESPColorCorrection &correction = this->parent_->correction_;
+  for (int raw = 0; raw < 256; raw++) {
+    Color result = correction.color_correct(op(correction.color_uncorrect(Color(raw, raw, raw, raw))));
+    for (int i = 0; i < 4; i++)
+      lookup[i * 256 + raw] = result.raw[i];
+  }
+  for (auto c : *this) {
+    c.set_raw(Color(lookup[c.get_red_raw()], lookup[256 + c.get_green_raw()], lookup[512 + c.get_blue_raw()],
+                    lookup[768 + c.get_white_raw()]));
+  }
+}
+
 void ESPRangeView::set(const Color &color) {
+  // all LEDs get the same color, so it only has to be corrected once
+  const Color corrected = this->parent_->correction_.color_correct(color);
   for (int32_t i = this->begin_; i < this->end_; i++) {
-    (*this->parent_)[i] = color;
+    (*this->parent_)[i].set_raw(corrected);
   }
 }
 
@@ -45,20 +78,24 @@ void ESPRangeView::set_effect_data(uint8_t effect_data) {
 }
 
 void ESPRangeView::fade_to_white(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_white(amnt);
+  this->map_([amnt](Color c) { return c.fade_to_white(amnt); });
 }
 void ESPRangeView::fade_to_black(uint8_t amnt) {
-  for (auto c : *this)
-    c.fade_to_black(amnt);
+  this->map_([amnt](Color c) { return c.fade_to_black(amnt); });
 }
 void ESPRangeView::lighten(uint8_t delta) {
-  for (auto c : *this)
-    c.lighten(delta);
+  this->map_([delta](Color c) { return c.lighten(delta); });
 }
 void ESPRangeView::darken(uint8_t delta) {
-  for (auto c : *this)
-    c.darken(delta);
+  this->map_([delta](Color c) { return c.darken(delta); });
+}
+void ESPRangeView::scale(uint8_t scale) {
+  this->map_([scale](Color c) { return c * scale; });
+}
+void ESPRangeView::blend(const Color &target, uint8_t amnt) {
+  const Color add = target * amnt;
+  const uint8_t inv_amnt = 255 - amnt;
+  this->map_([add, inv_amnt](Color c) { return add + c * inv_amnt; });
 }
 ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   // If size doesn't match, error (todo warning)
@@ -75,15 +112,16 @@ ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   if (rhs.begin_ == this->begin_)
     return *this;
 
+  // Within the same light the color correction is the same, so the raw values can be copied directly
   if (rhs.begin_ > this->begin_) {
     // Copy from left
     for (int32_t i = 0; i < this->size(); i++) {
-      (*this)[i].set(rhs[i].get());
+      (*this)[i].set_raw(rhs[i].get_raw());
     }
   } else {
     // Copy from right
     for (int32_t i = this->size() - 1; i >= 0; i--) {
-      (*this)[i].set(rhs[i].get());
+      (*this)[i].set_raw(rhs[i].get_raw());
     }
   }
 
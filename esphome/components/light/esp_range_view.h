@@ -37,6 +37,10 @@ class ESPRangeView : public ESPColorSettable {
   void fade_to_black(uint8_t amnt) override;
   void lighten(uint8_t delta) override;
   void darken(uint8_t delta) override;
+  /// Scale all LEDs in the range with the given factor.
+  void scale(uint8_t scale);
+  /// Blend all LEDs in the range towards the target color, i.e. set them to target * amnt + color * (255 - amnt).
+  void blend(const Color &target, uint8_t amnt);
 
   ESPRangeView &operator=(const Color &rhs) {
     this->set(rhs);
@@ -55,6 +59,9 @@ class ESPRangeView : public ESPColorSettable {
  protected:
   friend ESPRangeIterator;
 
+  /// Replace the color of every LED in the range with op(color), where op must treat every channel independently.
+  template<typename F> void map_(F &&op);
+
   AddressableLight *parent_;
   int32_t begin_;
   int32_t end_;
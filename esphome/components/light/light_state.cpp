@@ -130,10 +130,12 @@ void LightState::loop() {
   // Write state to the light
   if (this->next_write_) {
     this->next_write_ = false;
-    this->output_->write_state(this);
+    this->write_output_();
   }
 }
 
+void LightState::write_output_() { this->output_->write_state(this); }
+
 float LightState::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
 
 void LightState::publish_state() { this->remote_values_callback_.call(); }
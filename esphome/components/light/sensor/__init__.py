@@ -0,0 +1,54 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_ID,
+    CONF_LIGHT_ID,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_COUNTER,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+)
+
+from .. import CONF_FRAME_RATE, AddressableLightState, light_ns
+
+CONF_DROPPED_FRAMES = "dropped_frames"
+
+UNIT_FRAMES_PER_SECOND = "fps"
+
+AddressableLightStats = light_ns.class_("AddressableLightStats", cg.PollingComponent)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(AddressableLightStats),
+        cv.Required(CONF_LIGHT_ID): cv.use_id(AddressableLightState),
+        cv.Optional(CONF_FRAME_RATE): sensor.sensor_schema(
+            unit_of_measurement=UNIT_FRAMES_PER_SECOND,
+            icon=ICON_COUNTER,
+            accuracy_decimals=1,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_DROPPED_FRAMES): sensor.sensor_schema(
+            icon=ICON_COUNTER,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+).extend(cv.polling_component_schema("60s"))
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    light = await cg.get_variable(config[CONF_LIGHT_ID])
+    cg.add(var.set_light(light))
+
+    if frame_rate_config := config.get(CONF_FRAME_RATE):
+        sens = await sensor.new_sensor(frame_rate_config)
+        cg.add(var.set_frame_rate_sensor(sens))
+    if dropped_frames_config := config.get(CONF_DROPPED_FRAMES):
+        sens = await sensor.new_sensor(dropped_frames_config)
+        cg.add(var.set_dropped_frames_sensor(sens))
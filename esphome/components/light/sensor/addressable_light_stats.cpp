@@ -0,0 +1,37 @@
+#include "addressable_light_stats.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace light {
+
+static const char *const TAG = "light.stats";
+
+void AddressableLightStats::setup() {
+  this->last_update_ = millis();
+  this->last_frame_count_ = this->light_->get_frame_count();
+}
+
+void AddressableLightStats::update() {
+  const uint32_t now = millis();
+  const uint32_t frame_count = this->light_->get_frame_count();
+  if (this->frame_rate_sensor_ != nullptr && now != this->last_update_) {
+    this->frame_rate_sensor_->publish_state((frame_count - this->last_frame_count_) * 1000.0f /
+                                            (now - this->last_update_));
+  }
+  if (this->dropped_frames_sensor_ != nullptr)
+    this->dropped_frames_sensor_->publish_state(this->light_->get_dropped_frame_count());
+  this->last_update_ = now;
+  this->last_frame_count_ = frame_count;
+}
+
+void AddressableLightStats::dump_config() {
+  ESP_LOGCONFIG(TAG, "Addressable Light Stats:");
+  ESP_LOGCONFIG(TAG, "  Light: '%s'", this->light_->get_name().c_str());
+  LOG_UPDATE_INTERVAL(this);
+  LOG_SENSOR("  ", "Frame Rate", this->frame_rate_sensor_);
+  LOG_SENSOR("  ", "Dropped Frames", this->dropped_frames_sensor_);
+}
+
+}  // namespace light
+}  // namespace esphome
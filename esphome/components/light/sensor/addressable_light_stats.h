@@ -0,0 +1,32 @@
+#pragma once
+
+#include "../addressable_light.h"
+#include "esphome/core/component.h"
+#include "esphome/components/sensor/sensor.h"
+
+namespace esphome {
+namespace light {
+
+/// Reports the rendering statistics of an addressable light.
+class AddressableLightStats : public PollingComponent {
+ public:
+  void set_light(AddressableLightState *light) { this->light_ = light; }
+  void set_frame_rate_sensor(sensor::Sensor *frame_rate_sensor) { this->frame_rate_sensor_ = frame_rate_sensor; }
+  void set_dropped_frames_sensor(sensor::Sensor *dropped_frames_sensor) {
+    this->dropped_frames_sensor_ = dropped_frames_sensor;
+  }
+
+  void setup() override;
+  void update() override;
+  void dump_config() override;
+
+ protected:
+  AddressableLightState *light_;
+  sensor::Sensor *frame_rate_sensor_{nullptr};
+  sensor::Sensor *dropped_frames_sensor_{nullptr};
+  uint32_t last_update_{0};
+  uint32_t last_frame_count_{0};
+};
+
+}  // namespace light
+}  // namespace esphome
@@ -4,6 +4,7 @@
 #include "esphome/core/hal.h"
 #include "lvgl_hal.h"
 #include "lvgl_esphome.h"
+#include "lvgl_rotate.h"
 
 #include <numeric>
 
@@ -154,11 +155,7 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
   lv_color_t *dst = this->rotate_buf_;
   switch (this->rotation) {
     case display::DISPLAY_ROTATION_90_DEGREES:
-      for (lv_coord_t x = height; x-- != 0;) {
-        for (lv_coord_t y = 0; y != width; y++) {
-          dst[y * height + x] = *ptr++;
-        }
-      }
+      rotate_90(ptr, dst, width, height);
       y1 = x1;
       x1 = this->disp_drv_.ver_res - area->y1 - height;
       width = height;
@@ -166,21 +163,13 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, lv_color_t *ptr) {
       break;
 
     case display::DISPLAY_ROTATION_180_DEGREES:
-      for (lv_coord_t y = height; y-- != 0;) {
-        for (lv_coord_t x = width; x-- != 0;) {
-          dst[y * width + x] = *ptr++;
-        }
-      }
+      rotate_180(ptr, dst, width, height);
       x1 = this->disp_drv_.hor_res - x1 - width;
       y1 = this->disp_drv_.ver_res - y1 - height;
       break;
 
     case display::DISPLAY_ROTATION_270_DEGREES:
-      for (lv_coord_t x = 0; x != height; x++) {
-        for (lv_coord_t y = width; y-- != 0;) {
-          dst[y * height + x] = *ptr++;
-        }
-      }
+      rotate_270(ptr, dst, width, height);
       x1 = y1;
       y1 = this->disp_drv_.hor_res - area->x1 - width;
       width = height;
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace esphome {
+namespace lvgl {
+
+// Rotating with plain nested loops reads or writes a new cache line for every pixel, which is slow on PSRAM.
+// Copying square tiles instead keeps both source and destination within a few cache lines.
+static const int ROTATE_TILE_SIZE = 16;
+
+/// Call store(row, column, pixel) for every pixel of a width x height block of pixels, tile by tile.
+template<typename T, typename F> inline void rotate_tiled(const T *src, int width, int height, F &&store) {
+  for (int tile_y = 0; tile_y < height; tile_y += ROTATE_TILE_SIZE) {
+    const int y_end = std::min(tile_y + ROTATE_TILE_SIZE, height);
+    for (int tile_x = 0; tile_x < width; tile_x += ROTATE_TILE_SIZE) {
+      const int x_end = std::min(tile_x + ROTATE_TILE_SIZE, width);
+      for (int y = tile_y; y != y_end; y++) {
+        const T *row = src + static_cast<size_t>(y) * width;
+        for (int x = tile_x; x != x_end; x++)
+          store(y, x, row[x]);
+      }
+    }
+  }
+}
+
+/// Rotate a width x height block of pixels by 90 degrees into dst, which becomes height pixels wide.
+template<typename T> inline void rotate_90(const T *src, T *dst, int width, int height) {
+  rotate_tiled(src, width, height, [dst, height](int y, int x, const T &pixel) {
+    dst[static_cast<size_t>(x) * height + height - 1 - y] = pixel;
+  });
+}
+
+/// Rotate a width x height block of pixels by 180 degrees into dst.
+template<typename T> inline void rotate_180(const T *src, T *dst, int width, int height) {
+  // both buffers are walked sequentially, no tiling needed
+  std::reverse_copy(src, src + static_cast<size_t>(width) * height, dst);
+}
+
+/// Rotate a width x height block of pixels by 270 degrees into dst, which becomes height pixels wide.
+template<typename T> inline void rotate_270(const T *src, T *dst, int width, int height) {
+  rotate_tiled(src, width, height, [dst, width, height](int y, int x, const T &pixel) {
+    dst[static_cast<size_t>(width - 1 - x) * height + y] = pixel;
+  });
+}
+
+}  // namespace lvgl
+}  // namespace esphome
@@ -42,3 +42,5 @@ async def touchscreens_to_code(lv_component, config):
         listener = cg.new_Pvariable(tconf[CONF_ID], lpt, lprt, lv_component)
         lv.indev_drv_register(listener.get_drv())
         cg.add(touchscreen.register_listener(listener))
+        # touch input must not be read before the touchscreen has finished its setup
+        cg.add(cg.App.register_setup_dependency(lv_component, touchscreen))
@@ -44,7 +44,10 @@ struct mopeka_std_package {  // NOLINT(readability-identifier-naming,altera-stru
 
 class MopekaStdCheck : public Component, public esp32_ble_tracker::ESPBTDeviceListener {
  public:
-  void set_address(uint64_t address) { address_ = address; };
+  void set_address(uint64_t address) {
+    this->address_ = address;
+    this->add_address_filter(address);
+  };
 
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
   void dump_config() override;
@@ -66,6 +66,8 @@ def AUTO_LOAD():
 
 
 CONF_DISCOVER_IP = "discover_ip"
+CONF_DISCOVERY_BATCH_SIZE = "discovery_batch_size"
+CONF_DISCOVERY_SKIP_UNCHANGED = "discovery_skip_unchanged"
 CONF_IDF_SEND_ASYNC = "idf_send_async"
 CONF_SKIP_CERT_CN_CHECK = "skip_cert_cn_check"
 
@@ -237,6 +239,10 @@ CONFIG_SCHEMA = cv.All(
                 cv.boolean, cv.one_of("CLEAN", upper=True)
             ),
             cv.Optional(CONF_DISCOVERY_RETAIN, default=True): cv.boolean,
+            cv.Optional(CONF_DISCOVERY_SKIP_UNCHANGED, default=False): cv.boolean,
+            cv.Optional(CONF_DISCOVERY_BATCH_SIZE, default=4): cv.int_range(
+                min=0, max=255
+            ),
             cv.Optional(CONF_DISCOVER_IP, default=True): cv.boolean,
             cv.Optional(
                 CONF_DISCOVERY_PREFIX, default="homeassistant"
@@ -373,6 +379,9 @@ async def to_code(config):
             )
         )
 
+    cg.add(var.set_discovery_skip_unchanged(config[CONF_DISCOVERY_SKIP_UNCHANGED]))
+    cg.add(var.set_discovery_batch_size(config[CONF_DISCOVERY_BATCH_SIZE]))
+
     cg.add(var.set_topic_prefix(config[CONF_TOPIC_PREFIX], CORE.name))
 
     if config[CONF_USE_ABBREVIATIONS]:
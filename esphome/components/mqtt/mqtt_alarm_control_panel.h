@@ -17,7 +17,7 @@ class MQTTAlarmControlPanelComponent : public mqtt::MQTTComponent {
 
   void setup() override;
 
-  void send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) override;
+  void send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) override;
 
   bool send_initial_state() override;
 
@@ -62,6 +62,9 @@ class MQTTBackend {
                    message.retain);
   }
 
+  /// Number of bytes queued for sending that the broker has not received yet, 0 if the backend can't tell.
+  virtual size_t get_outbox_size() const { return 0; }
+
   // called from MQTTClient::loop()
   virtual void loop() {}
 };
@@ -122,6 +122,17 @@ class MQTTBackendESP32 final : public MQTTBackend {
   }
   using MQTTBackend::publish;
 
+  size_t get_outbox_size() const final {
+#if ESP_IDF_VERSION_MAJOR >= 5
+    if (!this->handler_)
+      return 0;
+    int size = esp_mqtt_client_get_outbox_size(this->handler_.get());
+    return size > 0 ? size : 0;
+#else
+    return 0;
+#endif
+  }
+
   void loop() final;
 
   void set_ca_certificate(const std::string &cert) { ca_certificate_ = cert; }
@@ -2,6 +2,7 @@
 
 #ifdef USE_MQTT
 
+#include <algorithm>
 #include <utility>
 #include "esphome/components/network/util.h"
 #include "esphome/core/application.h"
@@ -27,6 +28,9 @@ namespace mqtt {
 
 static const char *const TAG = "mqtt";
 
+/// Resending discovery and states pauses while more than this many bytes wait in the backend outbox.
+static const size_t RESEND_MAX_OUTBOX_SIZE = 4096;
+
 MQTTClientComponent::MQTTClientComponent() {
   global_mqtt_client = this;
   this->credentials_.client_id = App.get_name() + "-" + get_mac_address();
@@ -93,52 +97,52 @@ void MQTTClientComponent::send_device_info_() {
 
   this->publish_json(
       topic,
-      [](JsonObject root) {
+      [](json::JsonWriter &root) {
         uint8_t index = 0;
         for (auto &ip : network::get_ip_addresses()) {
           if (ip.is_set()) {
-            root["ip" + (index == 0 ? "" : esphome::to_string(index))] = ip.str();
+            root.add("ip" + (index == 0 ? "" : esphome::to_string(index)), ip.str());
             index++;
           }
         }
-        root["name"] = App.get_name();
+        root.add("name", App.get_name());
         if (!App.get_friendly_name().empty()) {
-          root["friendly_name"] = App.get_friendly_name();
+          root.add("friendly_name", App.get_friendly_name());
         }
 #ifdef USE_API
-        root["port"] = api::global_api_server->get_port();
+        root.add("port", api::global_api_server->get_port());
 #endif
-        root["version"] = ESPHOME_VERSION;
-        root["mac"] = get_mac_address();
+        root.add("version", ESPHOME_VERSION);
+        root.add("mac", get_mac_address());
 
 #ifdef USE_ESP8266
-        root["platform"] = "ESP8266";
+        root.add("platform", "ESP8266");
 #endif
 #ifdef USE_ESP32
-        root["platform"] = "ESP32";
+        root.add("platform", "ESP32");
 #endif
 #ifdef USE_LIBRETINY
-        root["platform"] = lt_cpu_get_model_name();
+        root.add("platform", lt_cpu_get_model_name());
 #endif
 
-        root["board"] = ESPHOME_BOARD;
+        root.add("board", ESPHOME_BOARD);
 #if defined(USE_WIFI)
-        root["network"] = "wifi";
+        root.add("network", "wifi");
 #elif defined(USE_ETHERNET)
-        root["network"] = "ethernet";
+        root.add("network", "ethernet");
 #endif
 
 #ifdef ESPHOME_PROJECT_NAME
-        root["project_name"] = ESPHOME_PROJECT_NAME;
-        root["project_version"] = ESPHOME_PROJECT_VERSION;
+        root.add("project_name", ESPHOME_PROJECT_NAME);
+        root.add("project_version", ESPHOME_PROJECT_VERSION);
 #endif  // ESPHOME_PROJECT_NAME
 
 #ifdef USE_DASHBOARD_IMPORT
-        root["package_import_url"] = dashboard_import::get_package_import_url();
+        root.add("package_import_url", dashboard_import::get_package_import_url());
 #endif
 
 #ifdef USE_API_NOISE
-        root["api_encryption"] = "Noise_NNpsk0_25519_ChaChaPoly_SHA256";
+        root.add("api_encryption", "Noise_NNpsk0_25519_ChaChaPoly_SHA256");
 #endif
       },
       2, this->discovery_info_.retain);
@@ -157,6 +161,10 @@ void MQTTClientComponent::dump_config() {
   if (!this->discovery_info_.prefix.empty()) {
     ESP_LOGCONFIG(TAG, "  Discovery prefix: '%s'", this->discovery_info_.prefix.c_str());
     ESP_LOGCONFIG(TAG, "  Discovery retain: %s", YESNO(this->discovery_info_.retain));
+    ESP_LOGCONFIG(TAG, "  Discovery skip unchanged: %s", YESNO(this->discovery_skip_unchanged_));
+  }
+  if (this->discovery_batch_size_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Discovery batch size: %u", this->discovery_batch_size_);
   }
   ESP_LOGCONFIG(TAG, "  Topic Prefix: '%s'", this->topic_prefix_.c_str());
   if (!this->log_message_.topic.empty()) {
@@ -302,6 +310,7 @@ void MQTTClientComponent::check_connected() {
 void MQTTClientComponent::loop() {
   // Call the backend loop first
   mqtt_backend_.loop();
+  this->resend_slots_ = this->discovery_batch_size_;
 
   if (this->disconnect_reason_.has_value()) {
     const LogString *reason_s;
@@ -425,6 +434,7 @@ void MQTTClientComponent::subscribe(const std::string &topic, mqtt_callback_t ca
   };
   this->resubscribe_subscription_(&subscription);
   this->subscriptions_.push_back(subscription);
+  this->subscription_trie_dirty_ = true;
 }
 
 void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_json_callback_t &callback, uint8_t qos) {
@@ -443,6 +453,7 @@ void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_js
   };
   this->resubscribe_subscription_(&subscription);
   this->subscriptions_.push_back(subscription);
+  this->subscription_trie_dirty_ = true;
 }
 
 void MQTTClientComponent::unsubscribe(const std::string &topic) {
@@ -464,6 +475,7 @@ void MQTTClientComponent::unsubscribe(const std::string &topic) {
       ++it;
     }
   }
+  this->subscription_trie_dirty_ = true;
 }
 
 // Publish
@@ -473,40 +485,71 @@ bool MQTTClientComponent::publish(const std::string &topic, const std::string &p
 
 bool MQTTClientComponent::publish(const std::string &topic, const char *payload, size_t payload_length, uint8_t qos,
                                   bool retain) {
-  return publish({.topic = topic, .payload = payload, .qos = qos, .retain = retain});
-}
-
-bool MQTTClientComponent::publish(const MQTTMessage &message) {
   if (!this->is_connected()) {
     // critical components will re-transmit their messages
     return false;
   }
-  bool logging_topic = this->log_message_.topic == message.topic;
-  bool ret = this->mqtt_backend_.publish(message);
+  bool logging_topic = this->log_message_.topic == topic;
+  bool ret = this->mqtt_backend_.publish(topic.c_str(), payload, payload_length, qos, retain);
   delay(0);
   if (!ret && !logging_topic && this->is_connected()) {
     delay(0);
-    ret = this->mqtt_backend_.publish(message);
+    ret = this->mqtt_backend_.publish(topic.c_str(), payload, payload_length, qos, retain);
     delay(0);
   }
 
   if (!logging_topic) {
     if (ret) {
-      ESP_LOGV(TAG, "Publish(topic='%s' payload='%s' retain=%d qos=%d)", message.topic.c_str(), message.payload.c_str(),
-               message.retain, message.qos);
+      ESP_LOGV(TAG, "Publish(topic='%s' payload='%.*s' retain=%d qos=%d)", topic.c_str(), (int) payload_length,
+               payload, retain, qos);
     } else {
-      ESP_LOGV(TAG, "Publish failed for topic='%s' (len=%u). will retry later..", message.topic.c_str(),
-               message.payload.length());
+      ESP_LOGV(TAG, "Publish failed for topic='%s' (len=%u). will retry later..", topic.c_str(), payload_length);
       this->status_momentary_warning("publish", 1000);
     }
   }
   return ret != 0;
 }
+
+bool MQTTClientComponent::publish(const MQTTMessage &message) {
+  return this->publish(message.topic, message.payload.data(), message.payload.size(), message.qos, message.retain);
+}
 bool MQTTClientComponent::publish_json(const std::string &topic, const json::json_build_t &f, uint8_t qos,
                                        bool retain) {
   std::string message = json::build_json(f);
   return this->publish(topic, message, qos, retain);
 }
+bool MQTTClientComponent::publish_json(const std::string &topic, const json::json_write_t &f, uint8_t qos,
+                                       bool retain) {
+  json::write_json(this->json_buffer_, f);
+  return this->publish(topic, this->json_buffer_.data(), this->json_buffer_.size(), qos, retain);
+}
+bool MQTTClientComponent::publish_discovery_json(const std::string &topic, const json::json_write_t &f, uint8_t qos,
+                                                 uint32_t &last_hash) {
+  json::write_json(this->json_buffer_, f);
+  // Retained payloads are still known to the broker after reconnecting, so unchanged ones don't need to be resent
+  bool skip_unchanged = this->discovery_skip_unchanged_ && this->discovery_info_.retain;
+  uint32_t hash = skip_unchanged ? fnv1_hash(this->json_buffer_) : 0;
+  if (skip_unchanged && hash == last_hash) {
+    ESP_LOGV(TAG, "Discovery for topic='%s' is unchanged, skipping", topic.c_str());
+    return true;
+  }
+  if (!this->publish(topic, this->json_buffer_.data(), this->json_buffer_.size(), qos, this->discovery_info_.retain))
+    return false;
+  last_hash = hash;
+  return true;
+}
+
+bool MQTTClientComponent::acquire_resend_slot() {
+  // Give the backend a chance to drain what was already queued
+  if (this->mqtt_backend_.get_outbox_size() > RESEND_MAX_OUTBOX_SIZE)
+    return false;
+  if (this->discovery_batch_size_ == 0)
+    return true;
+  if (this->resend_slots_ == 0)
+    return false;
+  this->resend_slots_--;
+  return true;
+}
 
 void MQTTClientComponent::enable() {
   if (this->state_ != MQTT_CLIENT_DISABLED)
@@ -525,72 +568,26 @@ void MQTTClientComponent::disable() {
   this->on_shutdown();
 }
 
-/** Check if the message topic matches the given subscription topic
- *
- * INFO: MQTT spec mandates that topics must not be empty and must be valid NULL-terminated UTF-8 strings.
- *
- * @param message The message topic that was received from the MQTT server. Note: this must not contain
- *                wildcard characters as mandated by the MQTT spec.
- * @param subscription The subscription topic we are matching against.
- * @param is_normal Is this a "normal" topic - Does the message topic not begin with a "$".
- * @param past_separator Are we past the first '/' topic separator.
- * @return true if the subscription topic matches the message topic, false otherwise.
- */
-static bool topic_match(const char *message, const char *subscription, bool is_normal, bool past_separator) {
-  // Reached end of both strings at the same time, this means we have a successful match
-  if (*message == '\0' && *subscription == '\0')
-    return true;
-
-  // Either the message or the subscribe are at the end. This means they don't match.
-  if (*message == '\0' || *subscription == '\0')
-    return false;
-
-  bool do_wildcards = is_normal || past_separator;
-
-  if (*subscription == '+' && do_wildcards) {
-    // single level wildcard
-    // consume + from subscription
-    subscription++;
-    // consume everything from message until '/' found or end of string
-    while (*message != '\0' && *message != '/') {
-      message++;
-    }
-    // after this, both pointers will point to a '/' or to the end of the string
-
-    return topic_match(message, subscription, is_normal, true);
-  }
-
-  if (*subscription == '#' && do_wildcards) {
-    // multilevel wildcard - MQTT mandates that this must be at end of subscribe topic
-    return true;
-  }
-
-  // this handles '/' and normal characters at the same time.
-  if (*message != *subscription)
-    return false;
-
-  past_separator = past_separator || *subscription == '/';
-
-  // consume characters
-  subscription++;
-  message++;
-
-  return topic_match(message, subscription, is_normal, past_separator);
-}
-
-static bool topic_match(const char *message, const char *subscription) {
-  return topic_match(message, subscription, *message != '\0' && *message != '$', false);
-}
-
 void MQTTClientComponent::on_message(const std::string &topic, const std::string &payload) {
 #ifdef USE_ESP8266
   // on ESP8266, this is called in lwIP/AsyncTCP task; some components do not like running
   // from a different task.
   this->defer([this, topic, payload]() {
 #endif
-    for (auto &subscription : this->subscriptions_) {
-      if (topic_match(topic.c_str(), subscription.topic.c_str()))
-        subscription.callback(topic, payload);
+    if (this->subscription_trie_dirty_) {
+      this->subscription_trie_.clear();
+      for (size_t i = 0; i < this->subscriptions_.size(); i++)
+        this->subscription_trie_.insert(this->subscriptions_[i].topic, i);
+      this->subscription_trie_dirty_ = false;
+    }
+
+    this->matched_subscriptions_.clear();
+    this->subscription_trie_.match(topic, this->matched_subscriptions_);
+    // Call back in subscription order, like a linear scan would
+    std::sort(this->matched_subscriptions_.begin(), this->matched_subscriptions_.end());
+    for (size_t index : this->matched_subscriptions_) {
+      if (index < this->subscriptions_.size())
+        this->subscriptions_[index].callback(topic, payload);
     }
 #ifdef USE_ESP8266
   });
@@ -17,6 +17,7 @@
 #include "mqtt_backend_libretiny.h"
 #endif
 #include "lwip/ip_addr.h"
+#include "mqtt_topic_trie.h"
 
 #include <vector>
 
@@ -133,6 +134,13 @@ class MQTTClientComponent : public Component {
   void disable_discovery();
   bool is_discovery_enabled() const;
   bool is_discovery_ip_enabled() const;
+  /** Set how many MQTT components may send their discovery payload and state per loop iteration.
+   *
+   * This spreads the burst of messages after (re)connecting over several loop iterations, 0 means no limit.
+   */
+  void set_discovery_batch_size(uint8_t batch_size) { this->discovery_batch_size_ = batch_size; }
+  /// Don't republish retained discovery payloads that did not change since they were last sent.
+  void set_discovery_skip_unchanged(bool skip_unchanged) { this->discovery_skip_unchanged_ = skip_unchanged; }
 
 #if ASYNC_TCP_SSL_ENABLED
   /** Add a SSL fingerprint to use for TCP SSL connections to the MQTT broker.
@@ -229,6 +237,32 @@ class MQTTClientComponent : public Component {
    */
   bool publish_json(const std::string &topic, const json::json_build_t &f, uint8_t qos = 0, bool retain = false);
 
+  /** Write and send a JSON MQTT message without building a JSON document first.
+   *
+   * The payload is written into a buffer that is reused between messages.
+   *
+   * @param topic The topic.
+   * @param f The Json Message writer.
+   * @param retain Whether to retain the message.
+   */
+  bool publish_json(const std::string &topic, const json::json_write_t &f, uint8_t qos = 0, bool retain = false);
+
+  /** Write and send a Home Assistant discovery payload, retained according to the discovery info.
+   *
+   * When unchanged discovery payloads are skipped and the payload still matches last_hash, it was already
+   * retained by the broker and is not sent again.
+   *
+   * @param topic The discovery topic.
+   * @param f The Json Message writer.
+   * @param last_hash The hash of the payload last sent to this topic, updated once the payload was sent.
+   * @return Whether the payload was sent or could be skipped.
+   */
+  bool publish_discovery_json(const std::string &topic, const json::json_write_t &f, uint8_t qos,
+                              uint32_t &last_hash);
+
+  /// Internal method for MQTT components to claim one of the discovery and state resends of this loop iteration.
+  bool acquire_resend_slot();
+
   /// Setup the MQTT client, registering a bunch of callbacks and attempting to connect.
   void setup() override;
   void dump_config() override;
@@ -311,9 +345,14 @@ class MQTTClientComponent : public Component {
   std::string topic_prefix_{};
   MQTTMessage log_message_;
   std::string payload_buffer_;
+  std::string json_buffer_;
   int log_level_{ESPHOME_LOG_LEVEL};
 
   std::vector<MQTTSubscription> subscriptions_;
+  /// Index of subscriptions_ by topic filter, rebuilt on the next message after the subscriptions changed.
+  MQTTTopicTrie subscription_trie_;
+  bool subscription_trie_dirty_{true};
+  std::vector<size_t> matched_subscriptions_;
 #if defined(USE_ESP32)
   MQTTBackendESP32 mqtt_backend_;
 #elif defined(USE_ESP8266)
@@ -334,6 +373,10 @@ class MQTTClientComponent : public Component {
   optional<MQTTClientDisconnectReason> disconnect_reason_{};
 
   bool publish_nan_as_none_{false};
+  bool discovery_skip_unchanged_{false};
+  uint8_t discovery_batch_size_{4};
+  /// Resends left in the current loop iteration.
+  uint8_t resend_slots_{0};
 };
 
 extern MQTTClientComponent *global_mqtt_client;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -13,152 +13,156 @@ static const char *const TAG = "mqtt.climate";
 
 using namespace esphome::climate;
 
-void MQTTClimateComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
+void MQTTClimateComponent::send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) {
   auto traits = this->device_->get_traits();
   // current_temperature_topic
   if (traits.get_supports_current_temperature()) {
-    root[MQTT_CURRENT_TEMPERATURE_TOPIC] = this->get_current_temperature_state_topic();
+    root.add(MQTT_CURRENT_TEMPERATURE_TOPIC, this->get_current_temperature_state_topic());
   }
   // current_humidity_topic
   if (traits.get_supports_current_humidity()) {
-    root[MQTT_CURRENT_HUMIDITY_TOPIC] = this->get_current_humidity_state_topic();
+    root.add(MQTT_CURRENT_HUMIDITY_TOPIC, this->get_current_humidity_state_topic());
   }
   // mode_command_topic
-  root[MQTT_MODE_COMMAND_TOPIC] = this->get_mode_command_topic();
+  root.add(MQTT_MODE_COMMAND_TOPIC, this->get_mode_command_topic());
   // mode_state_topic
-  root[MQTT_MODE_STATE_TOPIC] = this->get_mode_state_topic();
+  root.add(MQTT_MODE_STATE_TOPIC, this->get_mode_state_topic());
   // modes
-  JsonArray modes = root.createNestedArray(MQTT_MODES);
+  root.begin_array(MQTT_MODES);
   // sort array for nice UI in HA
   if (traits.supports_mode(CLIMATE_MODE_AUTO))
-    modes.add("auto");
-  modes.add("off");
+    root.add("auto");
+  root.add("off");
   if (traits.supports_mode(CLIMATE_MODE_COOL))
-    modes.add("cool");
+    root.add("cool");
   if (traits.supports_mode(CLIMATE_MODE_HEAT))
-    modes.add("heat");
+    root.add("heat");
   if (traits.supports_mode(CLIMATE_MODE_FAN_ONLY))
-    modes.add("fan_only");
+    root.add("fan_only");
   if (traits.supports_mode(CLIMATE_MODE_DRY))
-    modes.add("dry");
+    root.add("dry");
   if (traits.supports_mode(CLIMATE_MODE_HEAT_COOL))
-    modes.add("heat_cool");
+    root.add("heat_cool");
+  root.end_array();
 
   if (traits.get_supports_two_point_target_temperature()) {
     // temperature_low_command_topic
-    root[MQTT_TEMPERATURE_LOW_COMMAND_TOPIC] = this->get_target_temperature_low_command_topic();
+    root.add(MQTT_TEMPERATURE_LOW_COMMAND_TOPIC, this->get_target_temperature_low_command_topic());
     // temperature_low_state_topic
-    root[MQTT_TEMPERATURE_LOW_STATE_TOPIC] = this->get_target_temperature_low_state_topic();
+    root.add(MQTT_TEMPERATURE_LOW_STATE_TOPIC, this->get_target_temperature_low_state_topic());
     // temperature_high_command_topic
-    root[MQTT_TEMPERATURE_HIGH_COMMAND_TOPIC] = this->get_target_temperature_high_command_topic();
+    root.add(MQTT_TEMPERATURE_HIGH_COMMAND_TOPIC, this->get_target_temperature_high_command_topic());
     // temperature_high_state_topic
-    root[MQTT_TEMPERATURE_HIGH_STATE_TOPIC] = this->get_target_temperature_high_state_topic();
+    root.add(MQTT_TEMPERATURE_HIGH_STATE_TOPIC, this->get_target_temperature_high_state_topic());
   } else {
     // temperature_command_topic
-    root[MQTT_TEMPERATURE_COMMAND_TOPIC] = this->get_target_temperature_command_topic();
+    root.add(MQTT_TEMPERATURE_COMMAND_TOPIC, this->get_target_temperature_command_topic());
     // temperature_state_topic
-    root[MQTT_TEMPERATURE_STATE_TOPIC] = this->get_target_temperature_state_topic();
+    root.add(MQTT_TEMPERATURE_STATE_TOPIC, this->get_target_temperature_state_topic());
   }
 
   if (traits.get_supports_target_humidity()) {
     // target_humidity_command_topic
-    root[MQTT_TARGET_HUMIDITY_COMMAND_TOPIC] = this->get_target_humidity_command_topic();
+    root.add(MQTT_TARGET_HUMIDITY_COMMAND_TOPIC, this->get_target_humidity_command_topic());
     // target_humidity_state_topic
-    root[MQTT_TARGET_HUMIDITY_STATE_TOPIC] = this->get_target_humidity_state_topic();
+    root.add(MQTT_TARGET_HUMIDITY_STATE_TOPIC, this->get_target_humidity_state_topic());
   }
 
   // min_temp
-  root[MQTT_MIN_TEMP] = traits.get_visual_min_temperature();
+  root.add(MQTT_MIN_TEMP, traits.get_visual_min_temperature());
   // max_temp
-  root[MQTT_MAX_TEMP] = traits.get_visual_max_temperature();
+  root.add(MQTT_MAX_TEMP, traits.get_visual_max_temperature());
   // target_temp_step
-  root[MQTT_TARGET_TEMPERATURE_STEP] = roundf(traits.get_visual_target_temperature_step() * 10) * 0.1;
+  root.add(MQTT_TARGET_TEMPERATURE_STEP, roundf(traits.get_visual_target_temperature_step() * 10) * 0.1);
   // current_temp_step
-  root[MQTT_CURRENT_TEMPERATURE_STEP] = roundf(traits.get_visual_current_temperature_step() * 10) * 0.1;
+  root.add(MQTT_CURRENT_TEMPERATURE_STEP, roundf(traits.get_visual_current_temperature_step() * 10) * 0.1);
   // temperature units are always coerced to Celsius internally
-  root[MQTT_TEMPERATURE_UNIT] = "C";
+  root.add(MQTT_TEMPERATURE_UNIT, "C");
 
   // min_humidity
-  root[MQTT_MIN_HUMIDITY] = traits.get_visual_min_humidity();
+  root.add(MQTT_MIN_HUMIDITY, traits.get_visual_min_humidity());
   // max_humidity
-  root[MQTT_MAX_HUMIDITY] = traits.get_visual_max_humidity();
+  root.add(MQTT_MAX_HUMIDITY, traits.get_visual_max_humidity());
 
   if (traits.get_supports_presets() || !traits.get_supported_custom_presets().empty()) {
     // preset_mode_command_topic
-    root[MQTT_PRESET_MODE_COMMAND_TOPIC] = this->get_preset_command_topic();
+    root.add(MQTT_PRESET_MODE_COMMAND_TOPIC, this->get_preset_command_topic());
     // preset_mode_state_topic
-    root[MQTT_PRESET_MODE_STATE_TOPIC] = this->get_preset_state_topic();
+    root.add(MQTT_PRESET_MODE_STATE_TOPIC, this->get_preset_state_topic());
     // presets
-    JsonArray presets = root.createNestedArray("preset_modes");
+    root.begin_array("preset_modes");
     if (traits.supports_preset(CLIMATE_PRESET_HOME))
-      presets.add("home");
+      root.add("home");
     if (traits.supports_preset(CLIMATE_PRESET_AWAY))
-      presets.add("away");
+      root.add("away");
     if (traits.supports_preset(CLIMATE_PRESET_BOOST))
-      presets.add("boost");
+      root.add("boost");
     if (traits.supports_preset(CLIMATE_PRESET_COMFORT))
-      presets.add("comfort");
+      root.add("comfort");
     if (traits.supports_preset(CLIMATE_PRESET_ECO))
-      presets.add("eco");
+      root.add("eco");
     if (traits.supports_preset(CLIMATE_PRESET_SLEEP))
-      presets.add("sleep");
+      root.add("sleep");
     if (traits.supports_preset(CLIMATE_PRESET_ACTIVITY))
-      presets.add("activity");
+      root.add("activity");
     for (const auto &preset : traits.get_supported_custom_presets())
-      presets.add(preset);
+      root.add(preset);
+    root.end_array();
   }
 
   if (traits.get_supports_action()) {
     // action_topic
-    root[MQTT_ACTION_TOPIC] = this->get_action_state_topic();
+    root.add(MQTT_ACTION_TOPIC, this->get_action_state_topic());
   }
 
   if (traits.get_supports_fan_modes()) {
     // fan_mode_command_topic
-    root[MQTT_FAN_MODE_COMMAND_TOPIC] = this->get_fan_mode_command_topic();
+    root.add(MQTT_FAN_MODE_COMMAND_TOPIC, this->get_fan_mode_command_topic());
     // fan_mode_state_topic
-    root[MQTT_FAN_MODE_STATE_TOPIC] = this->get_fan_mode_state_topic();
+    root.add(MQTT_FAN_MODE_STATE_TOPIC, this->get_fan_mode_state_topic());
     // fan_modes
-    JsonArray fan_modes = root.createNestedArray("fan_modes");
+    root.begin_array("fan_modes");
     if (traits.supports_fan_mode(CLIMATE_FAN_ON))
-      fan_modes.add("on");
+      root.add("on");
     if (traits.supports_fan_mode(CLIMATE_FAN_OFF))
-      fan_modes.add("off");
+      root.add("off");
     if (traits.supports_fan_mode(CLIMATE_FAN_AUTO))
-      fan_modes.add("auto");
+      root.add("auto");
     if (traits.supports_fan_mode(CLIMATE_FAN_LOW))
-      fan_modes.add("low");
+      root.add("low");
     if (traits.supports_fan_mode(CLIMATE_FAN_MEDIUM))
-      fan_modes.add("medium");
+      root.add("medium");
     if (traits.supports_fan_mode(CLIMATE_FAN_HIGH))
-      fan_modes.add("high");
+      root.add("high");
     if (traits.supports_fan_mode(CLIMATE_FAN_MIDDLE))
-      fan_modes.add("middle");
+      root.add("middle");
     if (traits.supports_fan_mode(CLIMATE_FAN_FOCUS))
-      fan_modes.add("focus");
+      root.add("focus");
     if (traits.supports_fan_mode(CLIMATE_FAN_DIFFUSE))
-      fan_modes.add("diffuse");
+      root.add("diffuse");
     if (traits.supports_fan_mode(CLIMATE_FAN_QUIET))
-      fan_modes.add("quiet");
+      root.add("quiet");
     for (const auto &fan_mode : traits.get_supported_custom_fan_modes())
-      fan_modes.add(fan_mode);
+      root.add(fan_mode);
+    root.end_array();
   }
 
   if (traits.get_supports_swing_modes()) {
     // swing_mode_command_topic
-    root[MQTT_SWING_MODE_COMMAND_TOPIC] = this->get_swing_mode_command_topic();
+    root.add(MQTT_SWING_MODE_COMMAND_TOPIC, this->get_swing_mode_command_topic());
     // swing_mode_state_topic
-    root[MQTT_SWING_MODE_STATE_TOPIC] = this->get_swing_mode_state_topic();
+    root.add(MQTT_SWING_MODE_STATE_TOPIC, this->get_swing_mode_state_topic());
     // swing_modes
-    JsonArray swing_modes = root.createNestedArray("swing_modes");
+    root.begin_array("swing_modes");
     if (traits.supports_swing_mode(CLIMATE_SWING_OFF))
-      swing_modes.add("off");
+      root.add("off");
     if (traits.supports_swing_mode(CLIMATE_SWING_BOTH))
-      swing_modes.add("both");
+      root.add("both");
     if (traits.supports_swing_mode(CLIMATE_SWING_VERTICAL))
-      swing_modes.add("vertical");
+      root.add("vertical");
     if (traits.supports_swing_mode(CLIMATE_SWING_HORIZONTAL))
-      swing_modes.add("horizontal");
+      root.add("horizontal");
+    root.end_array();
   }
 
   config.state_topic = false;
@@ -60,19 +60,26 @@ bool MQTTComponent::publish_json(const std::string &topic, const json::json_buil
   return global_mqtt_client->publish_json(topic, f, this->qos_, this->retain_);
 }
 
+bool MQTTComponent::publish_json(const std::string &topic, const json::json_write_t &f) {
+  if (topic.empty())
+    return false;
+  return global_mqtt_client->publish_json(topic, f, this->qos_, this->retain_);
+}
+
 bool MQTTComponent::send_discovery_() {
   const MQTTDiscoveryInfo &discovery_info = global_mqtt_client->get_discovery_info();
 
   if (discovery_info.clean) {
     ESP_LOGV(TAG, "'%s': Cleaning discovery...", this->friendly_name().c_str());
+    this->discovery_hash_ = 0;
     return global_mqtt_client->publish(this->get_discovery_topic_(discovery_info), "", 0, this->qos_, true);
   }
 
   ESP_LOGV(TAG, "'%s': Sending discovery...", this->friendly_name().c_str());
 
-  return global_mqtt_client->publish_json(
+  return global_mqtt_client->publish_discovery_json(
       this->get_discovery_topic_(discovery_info),
-      [this](JsonObject root) {
+      [this](json::JsonWriter &root) {
         SendDiscoveryConfig config;
         config.state_topic = true;
         config.command_topic = true;
@@ -80,74 +87,74 @@ bool MQTTComponent::send_discovery_() {
         this->send_discovery(root, config);
         // Set subscription QoS (default is 0)
         if (this->subscribe_qos_ != 0) {
-          root[MQTT_QOS] = this->subscribe_qos_;
+          root.add(MQTT_QOS, this->subscribe_qos_);
         }
 
         // Fields from EntityBase
         if (this->get_entity()->has_own_name()) {
-          root[MQTT_NAME] = this->friendly_name();
+          root.add(MQTT_NAME, this->friendly_name());
         } else {
-          root[MQTT_NAME] = "";
+          root.add(MQTT_NAME, "");
         }
         if (this->is_disabled_by_default())
-          root[MQTT_ENABLED_BY_DEFAULT] = false;
+          root.add(MQTT_ENABLED_BY_DEFAULT, false);
         if (!this->get_icon().empty())
-          root[MQTT_ICON] = this->get_icon();
+          root.add(MQTT_ICON, this->get_icon());
 
         switch (this->get_entity()->get_entity_category()) {
           case ENTITY_CATEGORY_NONE:
             break;
           case ENTITY_CATEGORY_CONFIG:
-            root[MQTT_ENTITY_CATEGORY] = "config";
+            root.add(MQTT_ENTITY_CATEGORY, "config");
             break;
           case ENTITY_CATEGORY_DIAGNOSTIC:
-            root[MQTT_ENTITY_CATEGORY] = "diagnostic";
+            root.add(MQTT_ENTITY_CATEGORY, "diagnostic");
             break;
         }
 
         if (config.state_topic)
-          root[MQTT_STATE_TOPIC] = this->get_state_topic_();
+          root.add(MQTT_STATE_TOPIC, this->get_state_topic_());
         if (config.command_topic)
-          root[MQTT_COMMAND_TOPIC] = this->get_command_topic_();
+          root.add(MQTT_COMMAND_TOPIC, this->get_command_topic_());
         if (this->command_retain_)
-          root[MQTT_COMMAND_RETAIN] = true;
+          root.add(MQTT_COMMAND_RETAIN, true);
 
         if (this->availability_ == nullptr) {
           if (!global_mqtt_client->get_availability().topic.empty()) {
-            root[MQTT_AVAILABILITY_TOPIC] = global_mqtt_client->get_availability().topic;
+            root.add(MQTT_AVAILABILITY_TOPIC, global_mqtt_client->get_availability().topic);
             if (global_mqtt_client->get_availability().payload_available != "online")
-              root[MQTT_PAYLOAD_AVAILABLE] = global_mqtt_client->get_availability().payload_available;
+              root.add(MQTT_PAYLOAD_AVAILABLE, global_mqtt_client->get_availability().payload_available);
             if (global_mqtt_client->get_availability().payload_not_available != "offline")
-              root[MQTT_PAYLOAD_NOT_AVAILABLE] = global_mqtt_client->get_availability().payload_not_available;
+              root.add(MQTT_PAYLOAD_NOT_AVAILABLE, global_mqtt_client->get_availability().payload_not_available);
           }
         } else if (!this->availability_->topic.empty()) {
-          root[MQTT_AVAILABILITY_TOPIC] = this->availability_->topic;
+          root.add(MQTT_AVAILABILITY_TOPIC, this->availability_->topic);
           if (this->availability_->payload_available != "online")
-            root[MQTT_PAYLOAD_AVAILABLE] = this->availability_->payload_available;
+            root.add(MQTT_PAYLOAD_AVAILABLE, this->availability_->payload_available);
           if (this->availability_->payload_not_available != "offline")
-            root[MQTT_PAYLOAD_NOT_AVAILABLE] = this->availability_->payload_not_available;
+            root.add(MQTT_PAYLOAD_NOT_AVAILABLE, this->availability_->payload_not_available);
         }
 
         std::string unique_id = this->unique_id();
         const MQTTDiscoveryInfo &discovery_info = global_mqtt_client->get_discovery_info();
         if (!unique_id.empty()) {
-          root[MQTT_UNIQUE_ID] = unique_id;
+          root.add(MQTT_UNIQUE_ID, unique_id);
         } else {
           if (discovery_info.unique_id_generator == MQTT_MAC_ADDRESS_UNIQUE_ID_GENERATOR) {
             char friendly_name_hash[9];
             sprintf(friendly_name_hash, "%08" PRIx32, fnv1_hash(this->friendly_name()));
             friendly_name_hash[8] = 0;  // ensure the hash-string ends with null
-            root[MQTT_UNIQUE_ID] = get_mac_address() + "-" + this->component_type() + "-" + friendly_name_hash;
+            root.add(MQTT_UNIQUE_ID, get_mac_address() + "-" + this->component_type() + "-" + friendly_name_hash);
           } else {
             // default to almost-unique ID. It's a hack but the only way to get that
             // gorgeous device registry view.
-            root[MQTT_UNIQUE_ID] = "ESP" + this->component_type() + this->get_default_object_id_();
+            root.add(MQTT_UNIQUE_ID, "ESP" + this->component_type() + this->get_default_object_id_());
           }
         }
 
         const std::string &node_name = App.get_name();
         if (discovery_info.object_id_generator == MQTT_DEVICE_NAME_OBJECT_ID_GENERATOR)
-          root[MQTT_OBJECT_ID] = node_name + "_" + this->get_default_object_id_();
+          root.add(MQTT_OBJECT_ID, node_name + "_" + this->get_default_object_id_());
 
         std::string node_friendly_name = App.get_friendly_name();
         if (node_friendly_name.empty()) {
@@ -155,43 +162,48 @@ bool MQTTComponent::send_discovery_() {
         }
         const std::string &node_area = App.get_area();
 
-        JsonObject device_info = root.createNestedObject(MQTT_DEVICE);
+        root.begin_object(MQTT_DEVICE);
         const auto mac = get_mac_address();
-        device_info[MQTT_DEVICE_IDENTIFIERS] = mac;
-        device_info[MQTT_DEVICE_NAME] = node_friendly_name;
+        root.add(MQTT_DEVICE_IDENTIFIERS, mac);
+        root.add(MQTT_DEVICE_NAME, node_friendly_name);
 #ifdef ESPHOME_PROJECT_NAME
-        device_info[MQTT_DEVICE_SW_VERSION] = ESPHOME_PROJECT_VERSION " (ESPHome " ESPHOME_VERSION ")";
+        root.add(MQTT_DEVICE_SW_VERSION, ESPHOME_PROJECT_VERSION " (ESPHome " ESPHOME_VERSION ")");
         const char *model = std::strchr(ESPHOME_PROJECT_NAME, '.');
         if (model == nullptr) {  // must never happen but check anyway
-          device_info[MQTT_DEVICE_MODEL] = ESPHOME_BOARD;
-          device_info[MQTT_DEVICE_MANUFACTURER] = ESPHOME_PROJECT_NAME;
+          root.add(MQTT_DEVICE_MODEL, ESPHOME_BOARD);
+          root.add(MQTT_DEVICE_MANUFACTURER, ESPHOME_PROJECT_NAME);
         } else {
-          device_info[MQTT_DEVICE_MODEL] = model + 1;
-          device_info[MQTT_DEVICE_MANUFACTURER] = std::string(ESPHOME_PROJECT_NAME, model - ESPHOME_PROJECT_NAME);
+          root.add(MQTT_DEVICE_MODEL, model + 1);
+          root.add(MQTT_DEVICE_MANUFACTURER, std::string(ESPHOME_PROJECT_NAME, model - ESPHOME_PROJECT_NAME));
         }
 #else
-        device_info[MQTT_DEVICE_SW_VERSION] = ESPHOME_VERSION " (" + App.get_compilation_time() + ")";
-        device_info[MQTT_DEVICE_MODEL] = ESPHOME_BOARD;
+        root.add(MQTT_DEVICE_SW_VERSION, ESPHOME_VERSION " (" + App.get_compilation_time() + ")");
+        root.add(MQTT_DEVICE_MODEL, ESPHOME_BOARD);
 #if defined(USE_ESP8266) || defined(USE_ESP32)
-        device_info[MQTT_DEVICE_MANUFACTURER] = "Espressif";
+        root.add(MQTT_DEVICE_MANUFACTURER, "Espressif");
 #elif defined(USE_RP2040)
-        device_info[MQTT_DEVICE_MANUFACTURER] = "Raspberry Pi";
+        root.add(MQTT_DEVICE_MANUFACTURER, "Raspberry Pi");
 #elif defined(USE_BK72XX)
-        device_info[MQTT_DEVICE_MANUFACTURER] = "Beken";
+        root.add(MQTT_DEVICE_MANUFACTURER, "Beken");
 #elif defined(USE_RTL87XX)
-        device_info[MQTT_DEVICE_MANUFACTURER] = "Realtek";
+        root.add(MQTT_DEVICE_MANUFACTURER, "Realtek");
 #elif defined(USE_HOST)
-        device_info[MQTT_DEVICE_MANUFACTURER] = "Host";
+        root.add(MQTT_DEVICE_MANUFACTURER, "Host");
 #endif
 #endif
         if (!node_area.empty()) {
-          device_info[MQTT_DEVICE_SUGGESTED_AREA] = node_area;
+          root.add(MQTT_DEVICE_SUGGESTED_AREA, node_area);
         }
 
-        device_info[MQTT_DEVICE_CONNECTIONS][0][0] = "mac";
-        device_info[MQTT_DEVICE_CONNECTIONS][0][1] = mac;
+        root.begin_array(MQTT_DEVICE_CONNECTIONS);
+        root.begin_array();
+        root.add("mac");
+        root.add(mac);
+        root.end_array();
+        root.end_array();
+        root.end_object();
       },
-      this->qos_, discovery_info.retain);
+      this->qos_, this->discovery_hash_);
 }
 
 uint8_t MQTTComponent::get_qos() const { return this->qos_; }
@@ -244,17 +256,9 @@ void MQTTComponent::call_setup() {
 
   global_mqtt_client->register_mqtt_component(this);
 
-  if (!this->is_connected_())
-    return;
-
-  if (this->is_discovery_enabled()) {
-    if (!this->send_discovery_()) {
-      this->schedule_resend_state();
-    }
-  }
-  if (!this->send_initial_state()) {
+  // Discovery and the initial state are sent from loop(), paced together with the other components
+  if (this->is_connected_())
     this->schedule_resend_state();
-  }
 }
 
 void MQTTComponent::call_loop() {
@@ -263,7 +267,7 @@ void MQTTComponent::call_loop() {
 
   this->loop();
 
-  if (!this->resend_state_ || !this->is_connected_()) {
+  if (!this->resend_state_ || !this->is_connected_() || !global_mqtt_client->acquire_resend_slot()) {
     return;
   }
 
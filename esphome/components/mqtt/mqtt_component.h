@@ -63,7 +63,7 @@ class MQTTComponent : public Component {
   /// Constructs a MQTTComponent.
   explicit MQTTComponent();
 
-  /// Override setup_ so that we can call send_discovery() when needed.
+  /// Override setup_ so that we can schedule sending the discovery and initial state when needed.
   void call_setup() override;
 
   void call_loop() override;
@@ -71,7 +71,7 @@ class MQTTComponent : public Component {
   void call_dump_config() override;
 
   /// Send discovery info the Home Assistant, override this.
-  virtual void send_discovery(JsonObject root, SendDiscoveryConfig &config) = 0;
+  virtual void send_discovery(json::JsonWriter &root, SendDiscoveryConfig &config) = 0;
 
   virtual bool send_initial_state() = 0;
 
@@ -129,6 +129,13 @@ class MQTTComponent : public Component {
    */
   bool publish_json(const std::string &topic, const json::json_build_t &f);
 
+  /** Write and send a JSON MQTT message without building a JSON document first.
+   *
+   * @param topic The topic.
+   * @param f The Json Message writer.
+   */
+  bool publish_json(const std::string &topic, const json::json_write_t &f);
+
   /** Subscribe to a MQTT topic.
    *
    * @param topic The topic. Wildcards are currently not supported.
@@ -210,6 +217,8 @@ class MQTTComponent : public Component {
   uint8_t subscribe_qos_{0};
   bool discovery_enabled_{true};
   bool resend_state_{false};
+  /// Hash of the discovery payload last sent, used to skip resending it unchanged.
+  uint32_t discovery_hash_{0};
 };
 
 }  // namespace mqtt
@@ -62,21 +62,21 @@ void MQTTCoverComponent::dump_config() {
     ESP_LOGCONFIG(TAG, "  Tilt Command Topic: '%s'", this->get_tilt_command_topic().c_str());
   }
 }
-void MQTTCoverComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
+void MQTTCoverComponent::send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) {
   if (!this->cover_->get_device_class().empty())
-    root[MQTT_DEVICE_CLASS] = this->cover_->get_device_class();
+    root.add(MQTT_DEVICE_CLASS, this->cover_->get_device_class());
 
   auto traits = this->cover_->get_traits();
   if (traits.get_is_assumed_state()) {
-    root[MQTT_OPTIMISTIC] = true;
+    root.add(MQTT_OPTIMISTIC, true);
   }
   if (traits.get_supports_position()) {
-    root[MQTT_POSITION_TOPIC] = this->get_position_state_topic();
-    root[MQTT_SET_POSITION_TOPIC] = this->get_position_command_topic();
+    root.add(MQTT_POSITION_TOPIC, this->get_position_state_topic());
+    root.add(MQTT_SET_POSITION_TOPIC, this->get_position_command_topic());
   }
   if (traits.get_supports_tilt()) {
-    root[MQTT_TILT_STATUS_TOPIC] = this->get_tilt_state_topic();
-    root[MQTT_TILT_COMMAND_TOPIC] = this->get_tilt_command_topic();
+    root.add(MQTT_TILT_STATUS_TOPIC, this->get_tilt_state_topic());
+    root.add(MQTT_TILT_COMMAND_TOPIC, this->get_tilt_command_topic());
   }
   if (traits.get_supports_tilt() && !traits.get_supports_position()) {
     config.command_topic = false;
@@ -43,7 +43,7 @@ void MQTTDateComponent::dump_config() {
 std::string MQTTDateComponent::component_type() const { return "date"; }
 const EntityBase *MQTTDateComponent::get_entity() const { return this->date_; }
 
-void MQTTDateComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
+void MQTTDateComponent::send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) {
   // Nothing extra to add here
 }
 bool MQTTDateComponent::send_initial_state() {
@@ -54,10 +54,10 @@ bool MQTTDateComponent::send_initial_state() {
   }
 }
 bool MQTTDateComponent::publish_state(uint16_t year, uint8_t month, uint8_t day) {
-  return this->publish_json(this->get_state_topic_(), [year, month, day](JsonObject root) {
-    root["year"] = year;
-    root["month"] = month;
-    root["day"] = day;
+  return this->publish_json(this->get_state_topic_(), [year, month, day](json::JsonWriter &root) {
+    root.add("year", year);
+    root.add("month", month);
+    root.add("day", day);
   });
 }
 
@@ -54,7 +54,7 @@ void MQTTDateTimeComponent::dump_config() {
 std::string MQTTDateTimeComponent::component_type() const { return "datetime"; }
 const EntityBase *MQTTDateTimeComponent::get_entity() const { return this->datetime_; }
 
-void MQTTDateTimeComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
+void MQTTDateTimeComponent::send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) {
   // Nothing extra to add here
 }
 bool MQTTDateTimeComponent::send_initial_state() {
@@ -67,13 +67,13 @@ bool MQTTDateTimeComponent::send_initial_state() {
 }
 bool MQTTDateTimeComponent::publish_state(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute,
                                           uint8_t second) {
-  return this->publish_json(this->get_state_topic_(), [year, month, day, hour, minute, second](JsonObject root) {
-    root["year"] = year;
-    root["month"] = month;
-    root["day"] = day;
-    root["hour"] = hour;
-    root["minute"] = minute;
-    root["second"] = second;
+  return this->publish_json(this->get_state_topic_(), [year, month, day, hour, minute, second](json::JsonWriter &root) {
+    root.add("year", year);
+    root.add("month", month);
+    root.add("day", day);
+    root.add("hour", hour);
+    root.add("minute", minute);
+    root.add("second", second);
   });
 }
 
@@ -15,13 +15,14 @@ using namespace esphome::event;
 
 MQTTEventComponent::MQTTEventComponent(event::Event *event) : event_(event) {}
 
-void MQTTEventComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
-  JsonArray event_types = root.createNestedArray(MQTT_EVENT_TYPES);
+void MQTTEventComponent::send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) {
+  root.begin_array(MQTT_EVENT_TYPES);
   for (const auto &event_type : this->event_->get_event_types())
-    event_types.add(event_type);
+    root.add(event_type);
+  root.end_array();
 
   if (!this->event_->get_device_class().empty())
-    root[MQTT_DEVICE_CLASS] = this->event_->get_device_class();
+    root.add(MQTT_DEVICE_CLASS, this->event_->get_device_class());
 
   config.command_topic = false;
 }
@@ -41,7 +42,7 @@ void MQTTEventComponent::dump_config() {
 
 bool MQTTEventComponent::publish_event_(const std::string &event_type) {
   return this->publish_json(this->get_state_topic_(),
-                            [event_type](JsonObject root) { root[MQTT_EVENT_TYPE] = event_type; });
+                            [event_type](json::JsonWriter &root) { root.add(MQTT_EVENT_TYPE, event_type); });
 }
 
 std::string MQTTEventComponent::component_type() const { return "event"; }
@@ -15,7 +15,7 @@ class MQTTEventComponent : public mqtt::MQTTComponent {
  public:
   explicit MQTTEventComponent(event::Event *event);
 
-  void send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) override;
+  void send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) override;
 
   void setup() override;
 
@@ -14,9 +14,9 @@ static const char *const TAG = "mqtt.text_sensor";
 using namespace esphome::text_sensor;
 
 MQTTTextSensor::MQTTTextSensor(TextSensor *sensor) : sensor_(sensor) {}
-void MQTTTextSensor::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
+void MQTTTextSensor::send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) {
   if (!this->sensor_->get_device_class().empty())
-    root[MQTT_DEVICE_CLASS] = this->sensor_->get_device_class();
+    root.add(MQTT_DEVICE_CLASS, this->sensor_->get_device_class());
   config.command_topic = false;
 }
 void MQTTTextSensor::setup() {
@@ -43,7 +43,7 @@ void MQTTTimeComponent::dump_config() {
 std::string MQTTTimeComponent::component_type() const { return "time"; }
 const EntityBase *MQTTTimeComponent::get_entity() const { return this->time_; }
 
-void MQTTTimeComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
+void MQTTTimeComponent::send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) {
   // Nothing extra to add here
 }
 bool MQTTTimeComponent::send_initial_state() {
@@ -54,10 +54,10 @@ bool MQTTTimeComponent::send_initial_state() {
   }
 }
 bool MQTTTimeComponent::publish_state(uint8_t hour, uint8_t minute, uint8_t second) {
-  return this->publish_json(this->get_state_topic_(), [hour, minute, second](JsonObject root) {
-    root["hour"] = hour;
-    root["minute"] = minute;
-    root["second"] = second;
+  return this->publish_json(this->get_state_topic_(), [hour, minute, second](json::JsonWriter &root) {
+    root.add("hour", hour);
+    root.add("minute", minute);
+    root.add("second", second);
   });
 }
 
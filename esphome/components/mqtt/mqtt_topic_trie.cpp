@@ -0,0 +1,110 @@
+#include "mqtt_topic_trie.h"
+
+#ifdef USE_MQTT
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace mqtt {
+
+static int compare_level(const std::string &a, const char *b, size_t b_len) {
+  int ret = memcmp(a.data(), b, std::min(a.size(), b_len));
+  if (ret != 0)
+    return ret;
+  if (a.size() == b_len)
+    return 0;
+  return a.size() < b_len ? -1 : 1;
+}
+
+void MQTTTopicTrie::clear() { this->nodes_.clear(); }
+
+int32_t MQTTTopicTrie::find_child_(const Node &node, const char *level, size_t len) const {
+  auto it = std::lower_bound(node.children.begin(), node.children.end(), 0, [level, len](const Child &child, int) {
+    return compare_level(child.level, level, len) < 0;
+  });
+  if (it == node.children.end() || compare_level(it->level, level, len) != 0)
+    return -1;
+  return it->node;
+}
+
+void MQTTTopicTrie::insert(const std::string &filter, size_t value) {
+  if (this->nodes_.empty())
+    this->nodes_.emplace_back();
+
+  uint32_t node = 0;
+  const char *level = filter.c_str();
+  while (true) {
+    const char *end = strchr(level, '/');
+    size_t len = end == nullptr ? strlen(level) : end - level;
+
+    if (len == 1 && *level == '#') {
+      // MQTT mandates '#' to be the last level, anything after it is ignored
+      this->nodes_[node].hash_values.push_back(value);
+      return;
+    }
+
+    int32_t next;
+    if (len == 1 && *level == '+') {
+      next = this->nodes_[node].plus;
+      if (next < 0) {
+        next = this->nodes_.size();
+        this->nodes_.emplace_back();
+        this->nodes_[node].plus = next;
+      }
+    } else {
+      next = this->find_child_(this->nodes_[node], level, len);
+      if (next < 0) {
+        next = this->nodes_.size();
+        // emplace_back may move the nodes, so look the parent up again afterwards
+        this->nodes_.emplace_back();
+        auto &children = this->nodes_[node].children;
+        auto it = std::lower_bound(children.begin(), children.end(), 0, [level, len](const Child &child, int) {
+          return compare_level(child.level, level, len) < 0;
+        });
+        children.insert(it, Child{std::string(level, len), static_cast<uint32_t>(next)});
+      }
+    }
+    node = next;
+
+    if (end == nullptr)
+      break;
+    level = end + 1;
+  }
+  this->nodes_[node].values.push_back(value);
+}
+
+void MQTTTopicTrie::match_(uint32_t node, const char *level, bool first, std::vector<size_t> &out) const {
+  const Node &current = this->nodes_[node];
+  const char *end = strchr(level, '/');
+  size_t len = end == nullptr ? strlen(level) : end - level;
+  // Wildcards do not match the first level of "$" topics, nor an empty last level
+  bool wildcards = !(first && *level == '$') && (len != 0 || end != nullptr);
+
+  if (wildcards)
+    out.insert(out.end(), current.hash_values.begin(), current.hash_values.end());
+
+  int32_t literal = this->find_child_(current, level, len);
+  int32_t plus = wildcards ? current.plus : -1;
+  for (int32_t child : {literal, plus}) {
+    if (child < 0)
+      continue;
+    if (end == nullptr) {
+      const auto &values = this->nodes_[child].values;
+      out.insert(out.end(), values.begin(), values.end());
+    } else {
+      this->match_(child, end + 1, false, out);
+    }
+  }
+}
+
+void MQTTTopicTrie::match(const std::string &topic, std::vector<size_t> &out) const {
+  if (this->nodes_.empty())
+    return;
+  this->match_(0, topic.c_str(), true, out);
+}
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_MQTT
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace mqtt {
+
+/** Index of MQTT topic filters, split on '/' into one trie level per topic level.
+ *
+ * Every filter is stored with a caller supplied value (an index into the subscription list). Matching a topic walks
+ * the trie level by level, following the literal child, the '+' child and collecting '#' filters on the way, so the
+ * cost depends on the depth of the topic rather than on the number of filters.
+ *
+ * Wildcards never match the first level of a topic starting with '$', and neither '+' nor '#' match an empty last
+ * level.
+ */
+class MQTTTopicTrie {
+ public:
+  void clear();
+  void insert(const std::string &filter, size_t value);
+  /// Append the values of all filters matching topic to out, in no particular order.
+  void match(const std::string &topic, std::vector<size_t> &out) const;
+  bool empty() const { return this->nodes_.empty(); }
+
+ protected:
+  struct Child {
+    std::string level;
+    uint32_t node;
+  };
+  struct Node {
+    std::vector<Child> children;      ///< Literal levels, sorted by level.
+    int32_t plus{-1};                 ///< Index of the '+' child, -1 if there is none.
+    std::vector<size_t> values;       ///< Filters ending at this level.
+    std::vector<size_t> hash_values;  ///< Filters ending with '#' at this level.
+  };
+
+  int32_t find_child_(const Node &node, const char *level, size_t len) const;
+  void match_(uint32_t node, const char *level, bool first, std::vector<size_t> &out) const;
+
+  std::vector<Node> nodes_;
+};
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
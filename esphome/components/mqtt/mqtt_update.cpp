@@ -29,20 +29,20 @@ void MQTTUpdateComponent::setup() {
 }
 
 bool MQTTUpdateComponent::publish_state() {
-  return this->publish_json(this->get_state_topic_(), [this](JsonObject root) {
-    root["installed_version"] = this->update_->update_info.current_version;
-    root["latest_version"] = this->update_->update_info.latest_version;
-    root["title"] = this->update_->update_info.title;
+  return this->publish_json(this->get_state_topic_(), [this](json::JsonWriter &root) {
+    root.add("installed_version", this->update_->update_info.current_version);
+    root.add("latest_version", this->update_->update_info.latest_version);
+    root.add("title", this->update_->update_info.title);
     if (!this->update_->update_info.summary.empty())
-      root["release_summary"] = this->update_->update_info.summary;
+      root.add("release_summary", this->update_->update_info.summary);
     if (!this->update_->update_info.release_url.empty())
-      root["release_url"] = this->update_->update_info.release_url;
+      root.add("release_url", this->update_->update_info.release_url);
   });
 }
 
-void MQTTUpdateComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
-  root["schema"] = "json";
-  root[MQTT_PAYLOAD_INSTALL] = "INSTALL";
+void MQTTUpdateComponent::send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) {
+  root.add("schema", "json");
+  root.add(MQTT_PAYLOAD_INSTALL, "INSTALL");
 }
 
 bool MQTTUpdateComponent::send_initial_state() { return this->publish_state(); }
@@ -46,17 +46,17 @@ void MQTTValveComponent::dump_config() {
     ESP_LOGCONFIG(TAG, "  Position Command Topic: '%s'", this->get_position_command_topic().c_str());
   }
 }
-void MQTTValveComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
+void MQTTValveComponent::send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) {
   if (!this->valve_->get_device_class().empty())
-    root[MQTT_DEVICE_CLASS] = this->valve_->get_device_class();
+    root.add(MQTT_DEVICE_CLASS, this->valve_->get_device_class());
 
   auto traits = this->valve_->get_traits();
   if (traits.get_is_assumed_state()) {
-    root[MQTT_OPTIMISTIC] = true;
+    root.add(MQTT_OPTIMISTIC, true);
   }
   if (traits.get_supports_position()) {
-    root[MQTT_POSITION_TOPIC] = this->get_position_state_topic();
-    root[MQTT_SET_POSITION_TOPIC] = this->get_position_command_topic();
+    root.add(MQTT_POSITION_TOPIC, this->get_position_state_topic());
+    root.add(MQTT_SET_POSITION_TOPIC, this->get_position_command_topic());
   }
 }
 
@@ -16,7 +16,7 @@ class MQTTValveComponent : public mqtt::MQTTComponent {
   explicit MQTTValveComponent(valve::Valve *valve);
 
   void setup() override;
-  void send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) override;
+  void send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) override;
 
   MQTT_COMPONENT_CUSTOM_TOPIC(position, command)
   MQTT_COMPONENT_CUSTOM_TOPIC(position, state)
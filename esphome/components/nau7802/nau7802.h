@@ -62,6 +62,7 @@ class NAU7802Sensor : public sensor::Sensor, public PollingComponent, public i2c
   void setup() override;
   void loop() override;
   bool can_proceed() override;
+  bool is_setup_barrier() const override { return false; }
   void dump_config() override;
   float get_setup_priority() const override;
   void update() override;
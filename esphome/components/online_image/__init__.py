@@ -5,6 +5,7 @@ import esphome.codegen as cg
 from esphome.components.http_request import CONF_HTTP_REQUEST_ID, HttpRequestComponent
 from esphome.components.image import (
     CONF_INVERT_ALPHA,
+    CONF_NATIVE_FORMAT,
     CONF_TRANSPARENCY,
     IMAGE_SCHEMA,
     Image_,
@@ -117,7 +118,9 @@ def remove_options(*options):
 
 
 ONLINE_IMAGE_SCHEMA = (
-    IMAGE_SCHEMA.extend(remove_options(CONF_FILE, CONF_INVERT_ALPHA, CONF_DITHER))
+    IMAGE_SCHEMA.extend(
+        remove_options(CONF_FILE, CONF_INVERT_ALPHA, CONF_DITHER, CONF_NATIVE_FORMAT)
+    )
     .extend(
         {
             cv.Required(CONF_ID): cv.declare_id(OnlineImage),
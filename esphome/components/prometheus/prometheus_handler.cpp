@@ -2,169 +2,275 @@
 #ifdef USE_NETWORK
 #include "esphome/core/application.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
 namespace esphome {
 namespace prometheus {
 
+void PrometheusHandler::setup() {
+  // The labels of an entity never change, so render them once instead of on every scrape
+#ifdef USE_SENSOR
+  for (auto *obj : App.get_sensors())
+    this->add_labels_(obj);
+#endif
+#ifdef USE_BINARY_SENSOR
+  for (auto *obj : App.get_binary_sensors())
+    this->add_labels_(obj);
+#endif
+#ifdef USE_FAN
+  for (auto *obj : App.get_fans())
+    this->add_labels_(obj);
+#endif
+#ifdef USE_LIGHT
+  for (auto *obj : App.get_lights())
+    this->add_labels_(obj);
+#endif
+#ifdef USE_COVER
+  for (auto *obj : App.get_covers())
+    this->add_labels_(obj);
+#endif
+#ifdef USE_SWITCH
+  for (auto *obj : App.get_switches())
+    this->add_labels_(obj);
+#endif
+#ifdef USE_LOCK
+  for (auto *obj : App.get_locks())
+    this->add_labels_(obj);
+#endif
+#ifdef USE_TEXT_SENSOR
+  for (auto *obj : App.get_text_sensors())
+    this->add_labels_(obj);
+#endif
+#ifdef USE_NUMBER
+  for (auto *obj : App.get_numbers())
+    this->add_labels_(obj);
+#endif
+#ifdef USE_SELECT
+  for (auto *obj : App.get_selects())
+    this->add_labels_(obj);
+#endif
+#ifdef USE_MEDIA_PLAYER
+  for (auto *obj : App.get_media_players())
+    this->add_labels_(obj);
+#endif
+#ifdef USE_UPDATE
+  for (auto *obj : App.get_updates())
+    this->add_labels_(obj);
+#endif
+#ifdef USE_VALVE
+  for (auto *obj : App.get_valves())
+    this->add_labels_(obj);
+#endif
+
+  this->base_->init();
+  this->base_->add_handler(this);
+}
+
 void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
-  AsyncResponseStream *stream = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
-  std::string area = App.get_area();
-  std::string node = App.get_name();
-  std::string friendly_name = App.get_friendly_name();
+#ifdef USE_ARDUINO
+  AsyncResponseStream *response = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
+  PrometheusWriter stream([response](const char *data, size_t len) {
+    response->write(reinterpret_cast<const uint8_t *>(data), len);
+  });
+#else
+  req->begin_chunked_response(200, "text/plain; version=0.0.4; charset=utf-8");
+  PrometheusWriter stream([req](const char *data, size_t len) { req->send_chunk(data, len); });
+#endif
 
 #ifdef USE_SENSOR
-  this->sensor_type_(stream);
+  this->sensor_type_(&stream);
   for (auto *obj : App.get_sensors())
-    this->sensor_row_(stream, obj, area, node, friendly_name);
+    this->sensor_row_(&stream, obj);
 #endif
 
 #ifdef USE_BINARY_SENSOR
-  this->binary_sensor_type_(stream);
+  this->binary_sensor_type_(&stream);
   for (auto *obj : App.get_binary_sensors())
-    this->binary_sensor_row_(stream, obj, area, node, friendly_name);
+    this->binary_sensor_row_(&stream, obj);
 #endif
 
 #ifdef USE_FAN
-  this->fan_type_(stream);
+  this->fan_type_(&stream);
   for (auto *obj : App.get_fans())
-    this->fan_row_(stream, obj, area, node, friendly_name);
+    this->fan_row_(&stream, obj);
 #endif
 
 #ifdef USE_LIGHT
-  this->light_type_(stream);
+  this->light_type_(&stream);
   for (auto *obj : App.get_lights())
-    this->light_row_(stream, obj, area, node, friendly_name);
+    this->light_row_(&stream, obj);
 #endif
 
 #ifdef USE_COVER
-  this->cover_type_(stream);
+  this->cover_type_(&stream);
   for (auto *obj : App.get_covers())
-    this->cover_row_(stream, obj, area, node, friendly_name);
+    this->cover_row_(&stream, obj);
 #endif
 
 #ifdef USE_SWITCH
-  this->switch_type_(stream);
+  this->switch_type_(&stream);
   for (auto *obj : App.get_switches())
-    this->switch_row_(stream, obj, area, node, friendly_name);
+    this->switch_row_(&stream, obj);
 #endif
 
 #ifdef USE_LOCK
-  this->lock_type_(stream);
+  this->lock_type_(&stream);
   for (auto *obj : App.get_locks())
-    this->lock_row_(stream, obj, area, node, friendly_name);
+    this->lock_row_(&stream, obj);
 #endif
 
 #ifdef USE_TEXT_SENSOR
-  this->text_sensor_type_(stream);
+  this->text_sensor_type_(&stream);
   for (auto *obj : App.get_text_sensors())
-    this->text_sensor_row_(stream, obj, area, node, friendly_name);
+    this->text_sensor_row_(&stream, obj);
 #endif
 
 #ifdef USE_NUMBER
-  this->number_type_(stream);
+  this->number_type_(&stream);
   for (auto *obj : App.get_numbers())
-    this->number_row_(stream, obj, area, node, friendly_name);
+    this->number_row_(&stream, obj);
 #endif
 
 #ifdef USE_SELECT
-  this->select_type_(stream);
+  this->select_type_(&stream);
   for (auto *obj : App.get_selects())
-    this->select_row_(stream, obj, area, node, friendly_name);
+    this->select_row_(&stream, obj);
 #endif
 
 #ifdef USE_MEDIA_PLAYER
-  this->media_player_type_(stream);
+  this->media_player_type_(&stream);
   for (auto *obj : App.get_media_players())
-    this->media_player_row_(stream, obj, area, node, friendly_name);
+    this->media_player_row_(&stream, obj);
 #endif
 
 #ifdef USE_UPDATE
-  this->update_entity_type_(stream);
+  this->update_entity_type_(&stream);
   for (auto *obj : App.get_updates())
-    this->update_entity_row_(stream, obj, area, node, friendly_name);
+    this->update_entity_row_(&stream, obj);
 #endif
 
 #ifdef USE_VALVE
-  this->valve_type_(stream);
+  this->valve_type_(&stream);
   for (auto *obj : App.get_valves())
-    this->valve_row_(stream, obj, area, node, friendly_name);
+    this->valve_row_(&stream, obj);
 #endif
 
-  req->send(stream);
-}
-
-std::string PrometheusHandler::relabel_id_(EntityBase *obj) {
-  auto item = relabel_map_id_.find(obj);
-  return item == relabel_map_id_.end() ? obj->get_object_id() : item->second;
+  stream.flush_chunk();
+#ifdef USE_ARDUINO
+  req->send(response);
+#else
+  // An empty chunk ends the response
+  req->send_chunk(nullptr, 0);
+#endif
 }
 
-std::string PrometheusHandler::relabel_name_(EntityBase *obj) {
-  auto item = relabel_map_name_.find(obj);
-  return item == relabel_map_name_.end() ? obj->get_name() : item->second;
+void PrometheusHandler::add_labels_(EntityBase *obj) {
+  if (obj->is_internal() && !this->include_internal_)
+    return;
+  this->labels_map_.emplace(obj, this->build_labels_(obj));
 }
 
-void PrometheusHandler::add_area_label_(AsyncResponseStream *stream, std::string &area) {
+std::string PrometheusHandler::build_labels_(EntityBase *obj) {
+  std::string labels = "{id=\"";
+  auto id = this->relabel_map_id_.find(obj);
+  labels += id == this->relabel_map_id_.end() ? obj->get_object_id() : id->second;
+  const std::string &area = App.get_area();
   if (!area.empty()) {
-    stream->print(F("\",area=\""));
-    stream->print(area.c_str());
+    labels += "\",area=\"";
+    labels += area;
   }
-}
-
-void PrometheusHandler::add_node_label_(AsyncResponseStream *stream, std::string &node) {
+  const std::string &node = App.get_name();
   if (!node.empty()) {
-    stream->print(F("\",node=\""));
-    stream->print(node.c_str());
+    labels += "\",node=\"";
+    labels += node;
+  }
+  const std::string &friendly_name = App.get_friendly_name();
+  if (!friendly_name.empty()) {
+    labels += "\",friendly_name=\"";
+    labels += friendly_name;
+  }
+  labels += "\",name=\"";
+  auto name = this->relabel_map_name_.find(obj);
+  labels += name == this->relabel_map_name_.end() ? obj->get_name() : name->second;
+  return labels;
+}
+
+const std::string &PrometheusHandler::labels_(EntityBase *obj) {
+  auto item = this->labels_map_.find(obj);
+  if (item == this->labels_map_.end())
+    item = this->labels_map_.emplace(obj, this->build_labels_(obj)).first;
+  return item->second;
+}
+
+void PrometheusWriter::append(const char *data, size_t len) {
+  while (len > 0) {
+    size_t n = std::min(len, sizeof(this->buffer_) - this->length_);
+    memcpy(this->buffer_ + this->length_, data, n);
+    this->length_ += n;
+    data += n;
+    len -= n;
+    if (this->length_ == sizeof(this->buffer_))
+      this->flush_chunk();
   }
 }
 
-void PrometheusHandler::add_friendly_name_label_(AsyncResponseStream *stream, std::string &friendly_name) {
-  if (!friendly_name.empty()) {
-    stream->print(F("\",friendly_name=\""));
-    stream->print(friendly_name.c_str());
+void PrometheusWriter::flush_chunk() {
+  if (this->length_ == 0)
+    return;
+  this->callback_(this->buffer_, this->length_);
+  this->length_ = 0;
+}
+
+#ifndef USE_ARDUINO
+void PrometheusWriter::print(float value) {
+  // Matches to_string(float), which is limited to 32 characters
+  char tmp[33];
+  int len = snprintf(tmp, sizeof(tmp), "%f", value);
+  this->append(tmp, std::min<size_t>(len, sizeof(tmp) - 1));
+}
+#endif
+
+void PrometheusWriter::print_accuracy(float value, int8_t accuracy_decimals) {
+  if (accuracy_decimals < 0) {
+    auto multiplier = powf(10.0f, accuracy_decimals);
+    value = roundf(value * multiplier) / multiplier;
+    accuracy_decimals = 0;
   }
+  char tmp[32];
+  int len = snprintf(tmp, sizeof(tmp), "%.*f", accuracy_decimals, value);
+  this->append(tmp, std::min<size_t>(len, sizeof(tmp) - 1));
 }
 
 // Type-specific implementation
 #ifdef USE_SENSOR
-void PrometheusHandler::sensor_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::sensor_type_(PrometheusWriter *stream) {
   stream->print(F("#TYPE esphome_sensor_value gauge\n"));
   stream->print(F("#TYPE esphome_sensor_failed gauge\n"));
 }
-void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::sensor_row_(PrometheusWriter *stream, sensor::Sensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
+  const std::string &labels = this->labels_(obj);
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_sensor_failed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} 0\n"));
     // Data itself
-    stream->print(F("esphome_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_sensor_value"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\",unit=\""));
     stream->print(obj->get_unit_of_measurement().c_str());
     stream->print(F("\"} "));
-    stream->print(value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()).c_str());
+    stream->print_accuracy(obj->state, obj->get_accuracy_decimals());
     stream->print(F("\n"));
   } else {
     // Invalid state
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_sensor_failed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} 1\n"));
   }
 }
@@ -172,101 +278,66 @@ void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor
 
 // Type-specific implementation
 #ifdef USE_BINARY_SENSOR
-void PrometheusHandler::binary_sensor_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::binary_sensor_type_(PrometheusWriter *stream) {
   stream->print(F("#TYPE esphome_binary_sensor_value gauge\n"));
   stream->print(F("#TYPE esphome_binary_sensor_failed gauge\n"));
 }
-void PrometheusHandler::binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj,
-                                           std::string &area, std::string &node, std::string &friendly_name) {
+void PrometheusHandler::binary_sensor_row_(PrometheusWriter *stream, binary_sensor::BinarySensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
+  const std::string &labels = this->labels_(obj);
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_binary_sensor_failed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} 0\n"));
     // Data itself
-    stream->print(F("esphome_binary_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_binary_sensor_value"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} "));
     stream->print(obj->state);
     stream->print(F("\n"));
   } else {
     // Invalid state
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_binary_sensor_failed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_FAN
-void PrometheusHandler::fan_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::fan_type_(PrometheusWriter *stream) {
   stream->print(F("#TYPE esphome_fan_value gauge\n"));
   stream->print(F("#TYPE esphome_fan_failed gauge\n"));
   stream->print(F("#TYPE esphome_fan_speed gauge\n"));
   stream->print(F("#TYPE esphome_fan_oscillation gauge\n"));
 }
-void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj, std::string &area, std::string &node,
-                                 std::string &friendly_name) {
+void PrometheusHandler::fan_row_(PrometheusWriter *stream, fan::Fan *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(F("esphome_fan_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  const std::string &labels = this->labels_(obj);
+  stream->print(F("esphome_fan_failed"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\"} 0\n"));
   // Data itself
-  stream->print(F("esphome_fan_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  stream->print(F("esphome_fan_value"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\"} "));
   stream->print(obj->state);
   stream->print(F("\n"));
   // Speed if available
   if (obj->get_traits().supports_speed()) {
-    stream->print(F("esphome_fan_speed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_fan_speed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} "));
     stream->print(obj->speed);
     stream->print(F("\n"));
   }
   // Oscillation if available
   if (obj->get_traits().supports_oscillation()) {
-    stream->print(F("esphome_fan_oscillation{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_fan_oscillation"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} "));
     stream->print(obj->oscillating);
     stream->print(F("\n"));
@@ -275,23 +346,18 @@ void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj, std
 #endif
 
 #ifdef USE_LIGHT
-void PrometheusHandler::light_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::light_type_(PrometheusWriter *stream) {
   stream->print(F("#TYPE esphome_light_state gauge\n"));
   stream->print(F("#TYPE esphome_light_color gauge\n"));
   stream->print(F("#TYPE esphome_light_effect_active gauge\n"));
 }
-void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightState *obj, std::string &area,
-                                   std::string &node, std::string &friendly_name) {
+void PrometheusHandler::light_row_(PrometheusWriter *stream, light::LightState *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
+  const std::string &labels = this->labels_(obj);
   // State
-  stream->print(F("esphome_light_state{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  stream->print(F("esphome_light_state"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\"} "));
   stream->print(obj->remote_values.is_on());
   stream->print(F("\n"));
@@ -300,75 +366,40 @@ void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightStat
   float brightness, r, g, b, w;
   color.as_brightness(&brightness);
   color.as_rgbw(&r, &g, &b, &w);
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  stream->print(F("esphome_light_color"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\",channel=\"brightness\"} "));
   stream->print(brightness);
   stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  stream->print(F("esphome_light_color"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\",channel=\"r\"} "));
   stream->print(r);
   stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  stream->print(F("esphome_light_color"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\",channel=\"g\"} "));
   stream->print(g);
   stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  stream->print(F("esphome_light_color"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\",channel=\"b\"} "));
   stream->print(b);
   stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  stream->print(F("esphome_light_color"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\",channel=\"w\"} "));
   stream->print(w);
   stream->print(F("\n"));
   // Effect
   std::string effect = obj->get_effect_name();
   if (effect == "None") {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_light_effect_active"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\",effect=\"None\"} 0\n"));
   } else {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_light_effect_active"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\",effect=\""));
     stream->print(effect.c_str());
     stream->print(F("\"} 1\n"));
@@ -377,86 +408,56 @@ void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightStat
 #endif
 
 #ifdef USE_COVER
-void PrometheusHandler::cover_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::cover_type_(PrometheusWriter *stream) {
   stream->print(F("#TYPE esphome_cover_value gauge\n"));
   stream->print(F("#TYPE esphome_cover_failed gauge\n"));
 }
-void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *obj, std::string &area, std::string &node,
-                                   std::string &friendly_name) {
+void PrometheusHandler::cover_row_(PrometheusWriter *stream, cover::Cover *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
+  const std::string &labels = this->labels_(obj);
   if (!std::isnan(obj->position)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_cover_failed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} 0\n"));
     // Data itself
-    stream->print(F("esphome_cover_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_cover_value"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} "));
     stream->print(obj->position);
     stream->print(F("\n"));
     if (obj->get_traits().get_supports_tilt()) {
-      stream->print(F("esphome_cover_tilt{id=\""));
-      stream->print(relabel_id_(obj).c_str());
-      add_area_label_(stream, area);
-      add_node_label_(stream, node);
-      add_friendly_name_label_(stream, friendly_name);
-      stream->print(F("\",name=\""));
-      stream->print(relabel_name_(obj).c_str());
+      stream->print(F("esphome_cover_tilt"));
+      stream->append(labels.data(), labels.size());
       stream->print(F("\"} "));
       stream->print(obj->tilt);
       stream->print(F("\n"));
     }
   } else {
     // Invalid state
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_cover_failed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_SWITCH
-void PrometheusHandler::switch_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::switch_type_(PrometheusWriter *stream) {
   stream->print(F("#TYPE esphome_switch_value gauge\n"));
   stream->print(F("#TYPE esphome_switch_failed gauge\n"));
 }
-void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::switch_row_(PrometheusWriter *stream, switch_::Switch *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(F("esphome_switch_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  const std::string &labels = this->labels_(obj);
+  stream->print(F("esphome_switch_failed"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\"} 0\n"));
   // Data itself
-  stream->print(F("esphome_switch_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  stream->print(F("esphome_switch_value"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\"} "));
   stream->print(obj->state);
   stream->print(F("\n"));
@@ -464,30 +465,20 @@ void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch
 #endif
 
 #ifdef USE_LOCK
-void PrometheusHandler::lock_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::lock_type_(PrometheusWriter *stream) {
   stream->print(F("#TYPE esphome_lock_value gauge\n"));
   stream->print(F("#TYPE esphome_lock_failed gauge\n"));
 }
-void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj, std::string &area, std::string &node,
-                                  std::string &friendly_name) {
+void PrometheusHandler::lock_row_(PrometheusWriter *stream, lock::Lock *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(F("esphome_lock_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  const std::string &labels = this->labels_(obj);
+  stream->print(F("esphome_lock_failed"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\"} 0\n"));
   // Data itself
-  stream->print(F("esphome_lock_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  stream->print(F("esphome_lock_value"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\"} "));
   stream->print(obj->state);
   stream->print(F("\n"));
@@ -496,32 +487,22 @@ void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj,
 
 // Type-specific implementation
 #ifdef USE_TEXT_SENSOR
-void PrometheusHandler::text_sensor_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::text_sensor_type_(PrometheusWriter *stream) {
   stream->print(F("#TYPE esphome_text_sensor_value gauge\n"));
   stream->print(F("#TYPE esphome_text_sensor_failed gauge\n"));
 }
-void PrometheusHandler::text_sensor_row_(AsyncResponseStream *stream, text_sensor::TextSensor *obj, std::string &area,
-                                         std::string &node, std::string &friendly_name) {
+void PrometheusHandler::text_sensor_row_(PrometheusWriter *stream, text_sensor::TextSensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
+  const std::string &labels = this->labels_(obj);
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(F("esphome_text_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_text_sensor_failed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} 0\n"));
     // Data itself
-    stream->print(F("esphome_text_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_text_sensor_value"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\",value=\""));
     stream->print(obj->state.c_str());
     stream->print(F("\"} "));
@@ -529,13 +510,8 @@ void PrometheusHandler::text_sensor_row_(AsyncResponseStream *stream, text_senso
     stream->print(F("\n"));
   } else {
     // Invalid state
-    stream->print(F("esphome_text_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_text_sensor_failed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} 1\n"));
   }
 }
@@ -543,76 +519,51 @@ void PrometheusHandler::text_sensor_row_(AsyncResponseStream *stream, text_senso
 
 // Type-specific implementation
 #ifdef USE_NUMBER
-void PrometheusHandler::number_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::number_type_(PrometheusWriter *stream) {
   stream->print(F("#TYPE esphome_number_value gauge\n"));
   stream->print(F("#TYPE esphome_number_failed gauge\n"));
 }
-void PrometheusHandler::number_row_(AsyncResponseStream *stream, number::Number *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::number_row_(PrometheusWriter *stream, number::Number *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
+  const std::string &labels = this->labels_(obj);
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_number_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_number_failed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} 0\n"));
     // Data itself
-    stream->print(F("esphome_number_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_number_value"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} "));
     stream->print(obj->state);
     stream->print(F("\n"));
   } else {
     // Invalid state
-    stream->print(F("esphome_number_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_number_failed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_SELECT
-void PrometheusHandler::select_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::select_type_(PrometheusWriter *stream) {
   stream->print(F("#TYPE esphome_select_value gauge\n"));
   stream->print(F("#TYPE esphome_select_failed gauge\n"));
 }
-void PrometheusHandler::select_row_(AsyncResponseStream *stream, select::Select *obj, std::string &area,
-                                    std::string &node, std::string &friendly_name) {
+void PrometheusHandler::select_row_(PrometheusWriter *stream, select::Select *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
+  const std::string &labels = this->labels_(obj);
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(F("esphome_select_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_select_failed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} 0\n"));
     // Data itself
-    stream->print(F("esphome_select_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_select_value"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\",value=\""));
     stream->print(obj->state.c_str());
     stream->print(F("\"} "));
@@ -620,67 +571,42 @@ void PrometheusHandler::select_row_(AsyncResponseStream *stream, select::Select
     stream->print(F("\n"));
   } else {
     // Invalid state
-    stream->print(F("esphome_select_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_select_failed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_MEDIA_PLAYER
-void PrometheusHandler::media_player_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::media_player_type_(PrometheusWriter *stream) {
   stream->print(F("#TYPE esphome_media_player_state_value gauge\n"));
   stream->print(F("#TYPE esphome_media_player_volume gauge\n"));
   stream->print(F("#TYPE esphome_media_player_is_muted gauge\n"));
   stream->print(F("#TYPE esphome_media_player_failed gauge\n"));
 }
-void PrometheusHandler::media_player_row_(AsyncResponseStream *stream, media_player::MediaPlayer *obj,
-                                          std::string &area, std::string &node, std::string &friendly_name) {
+void PrometheusHandler::media_player_row_(PrometheusWriter *stream, media_player::MediaPlayer *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(F("esphome_media_player_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  const std::string &labels = this->labels_(obj);
+  stream->print(F("esphome_media_player_failed"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\"} 0\n"));
   // Data itself
-  stream->print(F("esphome_media_player_state_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  stream->print(F("esphome_media_player_state_value"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\",value=\""));
   stream->print(media_player::media_player_state_to_string(obj->state));
   stream->print(F("\"} "));
   stream->print(F("1.0"));
   stream->print(F("\n"));
-  stream->print(F("esphome_media_player_volume{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  stream->print(F("esphome_media_player_volume"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\"} "));
   stream->print(obj->volume);
   stream->print(F("\n"));
-  stream->print(F("esphome_media_player_is_muted{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  stream->print(F("esphome_media_player_is_muted"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\"} "));
   if (obj->is_muted()) {
     stream->print(F("1.0"));
@@ -692,13 +618,13 @@ void PrometheusHandler::media_player_row_(AsyncResponseStream *stream, media_pla
 #endif
 
 #ifdef USE_UPDATE
-void PrometheusHandler::update_entity_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::update_entity_type_(PrometheusWriter *stream) {
   stream->print(F("#TYPE esphome_update_entity_state gauge\n"));
   stream->print(F("#TYPE esphome_update_entity_info gauge\n"));
   stream->print(F("#TYPE esphome_update_entity_failed gauge\n"));
 }
 
-void PrometheusHandler::handle_update_state_(AsyncResponseStream *stream, update::UpdateState state) {
+void PrometheusHandler::handle_update_state_(PrometheusWriter *stream, update::UpdateState state) {
   switch (state) {
     case update::UpdateState::UPDATE_STATE_UNKNOWN:
       stream->print("unknown");
@@ -718,41 +644,26 @@ void PrometheusHandler::handle_update_state_(AsyncResponseStream *stream, update
   }
 }
 
-void PrometheusHandler::update_entity_row_(AsyncResponseStream *stream, update::UpdateEntity *obj, std::string &area,
-                                           std::string &node, std::string &friendly_name) {
+void PrometheusHandler::update_entity_row_(PrometheusWriter *stream, update::UpdateEntity *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
+  const std::string &labels = this->labels_(obj);
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(F("esphome_update_entity_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_update_entity_failed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} 0\n"));
     // First update state
-    stream->print(F("esphome_update_entity_state{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_update_entity_state"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\",value=\""));
     handle_update_state_(stream, obj->state);
     stream->print(F("\"} "));
     stream->print(F("1.0"));
     stream->print(F("\n"));
     // Next update info
-    stream->print(F("esphome_update_entity_info{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_update_entity_info"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\",current_version=\""));
     stream->print(obj->update_info.current_version.c_str());
     stream->print(F("\",latest_version=\""));
@@ -764,45 +675,30 @@ void PrometheusHandler::update_entity_row_(AsyncResponseStream *stream, update::
     stream->print(F("\n"));
   } else {
     // Invalid state
-    stream->print(F("esphome_update_entity_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_update_entity_failed"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_VALVE
-void PrometheusHandler::valve_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::valve_type_(PrometheusWriter *stream) {
   stream->print(F("#TYPE esphome_valve_operation gauge\n"));
   stream->print(F("#TYPE esphome_valve_failed gauge\n"));
   stream->print(F("#TYPE esphome_valve_position gauge\n"));
 }
 
-void PrometheusHandler::valve_row_(AsyncResponseStream *stream, valve::Valve *obj, std::string &area, std::string &node,
-                                   std::string &friendly_name) {
+void PrometheusHandler::valve_row_(PrometheusWriter *stream, valve::Valve *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(F("esphome_valve_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  const std::string &labels = this->labels_(obj);
+  stream->print(F("esphome_valve_failed"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\"} 0\n"));
   // Data itself
-  stream->print(F("esphome_valve_operation{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  add_area_label_(stream, area);
-  add_node_label_(stream, node);
-  add_friendly_name_label_(stream, friendly_name);
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
+  stream->print(F("esphome_valve_operation"));
+  stream->append(labels.data(), labels.size());
   stream->print(F("\",operation=\""));
   stream->print(valve::valve_operation_to_str(obj->current_operation));
   stream->print(F("\"} "));
@@ -810,13 +706,8 @@ void PrometheusHandler::valve_row_(AsyncResponseStream *stream, valve::Valve *ob
   stream->print(F("\n"));
   // Now see if position is supported
   if (obj->get_traits().get_supports_position()) {
-    stream->print(F("esphome_valve_position{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    add_area_label_(stream, area);
-    add_node_label_(stream, node);
-    add_friendly_name_label_(stream, friendly_name);
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
+    stream->print(F("esphome_valve_position"));
+    stream->append(labels.data(), labels.size());
     stream->print(F("\"} "));
     stream->print(obj->position);
     stream->print(F("\n"));
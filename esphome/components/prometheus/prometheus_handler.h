@@ -1,7 +1,10 @@
 #pragma once
 #include "esphome/core/defines.h"
 #ifdef USE_NETWORK
+#include <cstring>
+#include <functional>
 #include <map>
+#include <string>
 #include <utility>
 
 #include "esphome/components/web_server_base/web_server_base.h"
@@ -12,6 +15,48 @@
 namespace esphome {
 namespace prometheus {
 
+/// Collects the exposition text in a fixed buffer and hands it to the response one chunk at a time, instead of
+/// passing every label and value to the response separately.
+#ifdef USE_ARDUINO
+class PrometheusWriter : public Print {
+#else
+class PrometheusWriter {
+#endif
+ public:
+  using chunk_callback_t = std::function<void(const char *, size_t)>;
+
+  explicit PrometheusWriter(chunk_callback_t &&callback) : callback_(std::move(callback)) {}
+
+#ifdef USE_ARDUINO
+  // Values are formatted by Print, exactly like AsyncResponseStream formats them
+  using Print::write;
+  size_t write(uint8_t data) override {
+    this->append(reinterpret_cast<const char *>(&data), 1);
+    return 1;
+  }
+  size_t write(const uint8_t *data, size_t len) override {
+    this->append(reinterpret_cast<const char *>(data), len);
+    return len;
+  }
+#else
+  // Same formatting as the AsyncResponseStream of web_server_idf
+  void print(const char *str) { this->append(str, strlen(str)); }
+  void print(const std::string &str) { this->append(str.data(), str.size()); }
+  void print(float value);
+#endif
+
+  /// Print a sensor state like value_accuracy_to_string(), without the temporary string.
+  void print_accuracy(float value, int8_t accuracy_decimals);
+  void append(const char *data, size_t len);
+  /// Pass the buffered text on to the callback.
+  void flush_chunk();
+
+ protected:
+  chunk_callback_t callback_;
+  char buffer_[512];
+  size_t length_{0};
+};
+
 class PrometheusHandler : public AsyncWebHandler, public Component {
  public:
   PrometheusHandler(web_server_base::WebServerBase *base) : base_(base) {}
@@ -48,131 +93,115 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
 
   void handleRequest(AsyncWebServerRequest *req) override;
 
-  void setup() override {
-    this->base_->init();
-    this->base_->add_handler(this);
-  }
+  void setup() override;
   float get_setup_priority() const override {
     // After WiFi
     return setup_priority::WIFI - 1.0f;
   }
 
  protected:
-  std::string relabel_id_(EntityBase *obj);
-  std::string relabel_name_(EntityBase *obj);
-  void add_area_label_(AsyncResponseStream *stream, std::string &area);
-  void add_node_label_(AsyncResponseStream *stream, std::string &node);
-  void add_friendly_name_label_(AsyncResponseStream *stream, std::string &friendly_name);
+  void add_labels_(EntityBase *obj);
+  std::string build_labels_(EntityBase *obj);
+  /// Return the labels of an entity up to the value of its "name" label, built once in setup().
+  const std::string &labels_(EntityBase *obj);
 
 #ifdef USE_SENSOR
   /// Return the type for prometheus
-  void sensor_type_(AsyncResponseStream *stream);
+  void sensor_type_(PrometheusWriter *stream);
   /// Return the sensor state as prometheus data point
-  void sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void sensor_row_(PrometheusWriter *stream, sensor::Sensor *obj);
 #endif
 
 #ifdef USE_BINARY_SENSOR
   /// Return the type for prometheus
-  void binary_sensor_type_(AsyncResponseStream *stream);
+  void binary_sensor_type_(PrometheusWriter *stream);
   /// Return the binary sensor state as prometheus data point
-  void binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj, std::string &area,
-                          std::string &node, std::string &friendly_name);
+  void binary_sensor_row_(PrometheusWriter *stream, binary_sensor::BinarySensor *obj);
 #endif
 
 #ifdef USE_FAN
   /// Return the type for prometheus
-  void fan_type_(AsyncResponseStream *stream);
+  void fan_type_(PrometheusWriter *stream);
   /// Return the fan state as prometheus data point
-  void fan_row_(AsyncResponseStream *stream, fan::Fan *obj, std::string &area, std::string &node,
-                std::string &friendly_name);
+  void fan_row_(PrometheusWriter *stream, fan::Fan *obj);
 #endif
 
 #ifdef USE_LIGHT
   /// Return the type for prometheus
-  void light_type_(AsyncResponseStream *stream);
+  void light_type_(PrometheusWriter *stream);
   /// Return the light values state as prometheus data point
-  void light_row_(AsyncResponseStream *stream, light::LightState *obj, std::string &area, std::string &node,
-                  std::string &friendly_name);
+  void light_row_(PrometheusWriter *stream, light::LightState *obj);
 #endif
 
 #ifdef USE_COVER
   /// Return the type for prometheus
-  void cover_type_(AsyncResponseStream *stream);
+  void cover_type_(PrometheusWriter *stream);
   /// Return the cover values state as prometheus data point
-  void cover_row_(AsyncResponseStream *stream, cover::Cover *obj, std::string &area, std::string &node,
-                  std::string &friendly_name);
+  void cover_row_(PrometheusWriter *stream, cover::Cover *obj);
 #endif
 
 #ifdef USE_SWITCH
   /// Return the type for prometheus
-  void switch_type_(AsyncResponseStream *stream);
+  void switch_type_(PrometheusWriter *stream);
   /// Return the switch values state as prometheus data point
-  void switch_row_(AsyncResponseStream *stream, switch_::Switch *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void switch_row_(PrometheusWriter *stream, switch_::Switch *obj);
 #endif
 
 #ifdef USE_LOCK
   /// Return the type for prometheus
-  void lock_type_(AsyncResponseStream *stream);
+  void lock_type_(PrometheusWriter *stream);
   /// Return the lock values state as prometheus data point
-  void lock_row_(AsyncResponseStream *stream, lock::Lock *obj, std::string &area, std::string &node,
-                 std::string &friendly_name);
+  void lock_row_(PrometheusWriter *stream, lock::Lock *obj);
 #endif
 
 #ifdef USE_TEXT_SENSOR
   /// Return the type for prometheus
-  void text_sensor_type_(AsyncResponseStream *stream);
+  void text_sensor_type_(PrometheusWriter *stream);
   /// Return the text sensor values state as prometheus data point
-  void text_sensor_row_(AsyncResponseStream *stream, text_sensor::TextSensor *obj, std::string &area, std::string &node,
-                        std::string &friendly_name);
+  void text_sensor_row_(PrometheusWriter *stream, text_sensor::TextSensor *obj);
 #endif
 
 #ifdef USE_NUMBER
   /// Return the type for prometheus
-  void number_type_(AsyncResponseStream *stream);
+  void number_type_(PrometheusWriter *stream);
   /// Return the number state as prometheus data point
-  void number_row_(AsyncResponseStream *stream, number::Number *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void number_row_(PrometheusWriter *stream, number::Number *obj);
 #endif
 
 #ifdef USE_SELECT
   /// Return the type for prometheus
-  void select_type_(AsyncResponseStream *stream);
+  void select_type_(PrometheusWriter *stream);
   /// Return the select state as prometheus data point
-  void select_row_(AsyncResponseStream *stream, select::Select *obj, std::string &area, std::string &node,
-                   std::string &friendly_name);
+  void select_row_(PrometheusWriter *stream, select::Select *obj);
 #endif
 
 #ifdef USE_MEDIA_PLAYER
   /// Return the type for prometheus
-  void media_player_type_(AsyncResponseStream *stream);
+  void media_player_type_(PrometheusWriter *stream);
   /// Return the media player state as prometheus data point
-  void media_player_row_(AsyncResponseStream *stream, media_player::MediaPlayer *obj, std::string &area,
-                         std::string &node, std::string &friendly_name);
+  void media_player_row_(PrometheusWriter *stream, media_player::MediaPlayer *obj);
 #endif
 
 #ifdef USE_UPDATE
   /// Return the type for prometheus
-  void update_entity_type_(AsyncResponseStream *stream);
+  void update_entity_type_(PrometheusWriter *stream);
   /// Return the update state and info as prometheus data point
-  void update_entity_row_(AsyncResponseStream *stream, update::UpdateEntity *obj, std::string &area, std::string &node,
-                          std::string &friendly_name);
-  void handle_update_state_(AsyncResponseStream *stream, update::UpdateState state);
+  void update_entity_row_(PrometheusWriter *stream, update::UpdateEntity *obj);
+  void handle_update_state_(PrometheusWriter *stream, update::UpdateState state);
 #endif
 
 #ifdef USE_VALVE
   /// Return the type for prometheus
-  void valve_type_(AsyncResponseStream *stream);
+  void valve_type_(PrometheusWriter *stream);
   /// Return the valve state as prometheus data point
-  void valve_row_(AsyncResponseStream *stream, valve::Valve *obj, std::string &area, std::string &node,
-                  std::string &friendly_name);
+  void valve_row_(PrometheusWriter *stream, valve::Valve *obj);
 #endif
 
   web_server_base::WebServerBase *base_;
   bool include_internal_{false};
   std::map<EntityBase *, std::string> relabel_map_id_;
   std::map<EntityBase *, std::string> relabel_map_name_;
+  std::map<EntityBase *, std::string> labels_map_;
 };
 
 }  // namespace prometheus
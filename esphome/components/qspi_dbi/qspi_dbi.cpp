@@ -31,28 +31,36 @@ void QspiDbi::update() {
     return;
   }
   this->do_update_();
-  if (this->buffer_ == nullptr || this->x_low_ > this->x_high_ || this->y_low_ > this->y_high_)
+  if (this->buffer_ == nullptr || this->dirty_regions_.empty())
     return;
+  if (this->draw_from_origin_) {
+    // every write starts at the origin, so a single one has to cover all changed rows
+    display::Rect rows;
+    for (const auto &region : this->dirty_regions_)
+      rows.extend(region);
+    this->write_region_(rows);
+  } else {
+    for (const auto &region : this->dirty_regions_)
+      this->write_region_(region);
+  }
+  this->dirty_regions_.clear();
+}
+
+void QspiDbi::write_region_(const display::Rect &region) {
   // Some chips require that the drawing window be aligned on certain boundaries
   auto dr = this->draw_rounding_;
-  this->x_low_ = this->x_low_ / dr * dr;
-  this->y_low_ = this->y_low_ / dr * dr;
-  this->x_high_ = (this->x_high_ + dr) / dr * dr - 1;
-  this->y_high_ = (this->y_high_ + dr) / dr * dr - 1;
+  int x_low = region.x / dr * dr;
+  int y_low = region.y / dr * dr;
+  int x_high = (region.x2() - 1 + dr) / dr * dr - 1;
+  int y_high = (region.y2() - 1 + dr) / dr * dr - 1;
   if (this->draw_from_origin_) {
-    this->x_low_ = 0;
-    this->y_low_ = 0;
-    this->x_high_ = this->width_ - 1;
+    x_low = 0;
+    y_low = 0;
+    x_high = this->width_ - 1;
   }
-  int w = this->x_high_ - this->x_low_ + 1;
-  int h = this->y_high_ - this->y_low_ + 1;
-  this->write_to_display_(this->x_low_, this->y_low_, w, h, this->buffer_, this->x_low_, this->y_low_,
-                          this->width_ - w - this->x_low_);
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
+  int w = x_high - x_low + 1;
+  int h = y_high - y_low + 1;
+  this->write_to_display_(x_low, y_low, w, h, this->buffer_, x_low, y_low, this->width_ - w - x_low);
 }
 
 void QspiDbi::draw_absolute_pixel_internal(int x, int y, Color color) {
@@ -78,15 +86,8 @@ void QspiDbi::draw_absolute_pixel_internal(int x, int y, Color color) {
     updated = true;
   }
   if (updated) {
-    // low and high watermark may speed up drawing from buffer
-    if (x < this->x_low_)
-      this->x_low_ = x;
-    if (y < this->y_low_)
-      this->y_low_ = y;
-    if (x > this->x_high_)
-      this->x_high_ = x;
-    if (y > this->y_high_)
-      this->y_high_ = y;
+    // tracking the changed regions may speed up drawing from buffer
+    this->dirty_regions_.add(x, y);
   }
 }
 
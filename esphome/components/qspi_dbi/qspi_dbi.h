@@ -8,6 +8,7 @@
 #include "esphome/components/display/display.h"
 #include "esphome/components/display/display_buffer.h"
 #include "esphome/components/display/display_color_utils.h"
+#include "esphome/components/display/dirty_regions.h"
 
 #include "esp_lcd_panel_rgb.h"
 
@@ -141,13 +142,12 @@ class QspiDbi : public display::DisplayBuffer,
   void reset_params_(bool ready = false);
   void write_init_sequence_();
   void set_addr_window_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+  /// Send the part of the buffer within region, widened to the draw rounding, to the display.
+  void write_region_(const display::Rect &region);
 
   GPIOPin *reset_pin_{nullptr};
   GPIOPin *enable_pin_{nullptr};
-  uint16_t x_low_{1};
-  uint16_t y_low_{1};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
+  display::DirtyRegions dirty_regions_{};
   bool setup_complete_{};
 
   bool invert_colors_{};
@@ -93,6 +93,8 @@ std::string AEHAProtocol::format_data_(const std::vector<uint8_t> &data) {
   return out;
 }
 
+RemoteHeader AEHAProtocol::header() const { return {HEADER_HIGH_US, HEADER_LOW_US, 2 + 32 * 2}; }
+
 void AEHAProtocol::dump(const AEHAData &data) {
   auto data_str = format_data_(data.data);
   ESP_LOGI(TAG, "Received AEHA: address=0x%04X, data=[%s]", data.address, data_str.c_str());
@@ -86,6 +86,8 @@ optional<DishData> DishProtocol::decode(RemoteReceiveData src) {
   return data;
 }
 
+RemoteHeader DishProtocol::header() const { return {HEADER_HIGH_US, HEADER_LOW_US, 2 + 16 * 2}; }
+
 void DishProtocol::dump(const DishData &data) {
   ESP_LOGI(TAG, "Received Dish: address=0x%02X, command=0x%02X", data.address, data.command);
 }
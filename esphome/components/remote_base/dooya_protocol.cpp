@@ -111,6 +111,8 @@ optional<DooyaData> DooyaProtocol::decode(RemoteReceiveData src) {
 
   return out;
 }
+RemoteHeader DooyaProtocol::header() const { return {HEADER_HIGH_US, HEADER_LOW_US, 2 + 32 * 2}; }
+
 void DooyaProtocol::dump(const DooyaData &data) {
   ESP_LOGI(TAG, "Received Dooya: id=0x%08" PRIX32 ", channel=%d, button=%d, check=%d", data.id, data.channel,
            data.button, data.check);
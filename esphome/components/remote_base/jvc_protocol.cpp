@@ -46,6 +46,8 @@ optional<JVCData> JVCProtocol::decode(RemoteReceiveData src) {
   }
   return out;
 }
+RemoteHeader JVCProtocol::header() const { return {HEADER_HIGH_US, HEADER_LOW_US, 2 + NBITS * 2}; }
+
 void JVCProtocol::dump(const JVCData &data) { ESP_LOGI(TAG, "Received JVC: data=0x%04" PRIX32, data.data); }
 
 }  // namespace remote_base
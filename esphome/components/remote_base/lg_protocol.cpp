@@ -50,6 +50,8 @@ optional<LGData> LGProtocol::decode(RemoteReceiveData src) {
 
   return out;
 }
+RemoteHeader LGProtocol::header() const { return {HEADER_HIGH_US, HEADER_LOW_US, 2 + 28 * 2}; }
+
 void LGProtocol::dump(const LGData &data) {
   ESP_LOGI(TAG, "Received LG: data=0x%08" PRIX32 ", nbits=%d", data.data, data.nbits);
 }
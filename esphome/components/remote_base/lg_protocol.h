@@ -20,6 +20,7 @@ class LGProtocol : public RemoteProtocol<LGData> {
   void encode(RemoteTransmitData *dst, const LGData &data) override;
   optional<LGData> decode(RemoteReceiveData src) override;
   void dump(const LGData &data) override;
+  RemoteHeader header() const override;
 };
 
 DECLARE_REMOTE_PROTOCOL(LG)
@@ -70,6 +70,8 @@ optional<MideaData> MideaProtocol::decode(RemoteReceiveData src) {
   return {};
 }
 
+RemoteHeader MideaProtocol::header() const { return {HEADER_MARK_US, HEADER_SPACE_US, 2}; }
+
 void MideaProtocol::dump(const MideaData &data) { ESP_LOGI(TAG, "Received Midea: %s", data.to_string().c_str()); }
 
 }  // namespace remote_base
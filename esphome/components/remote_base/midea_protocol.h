@@ -65,6 +65,7 @@ class MideaProtocol : public RemoteProtocol<MideaData> {
   void encode(RemoteTransmitData *dst, const MideaData &src) override;
   optional<MideaData> decode(RemoteReceiveData src) override;
   void dump(const MideaData &data) override;
+  RemoteHeader header() const override;
 };
 
 DECLARE_REMOTE_PROTOCOL(Midea)
@@ -76,6 +76,10 @@ optional<MirageData> MirageProtocol::decode(RemoteReceiveData src) {
   return out;
 }
 
+RemoteHeader MirageProtocol::header() const {
+  return {HEADER_MARK_US, HEADER_SPACE_US, 3 + MIRAGE_IR_PACKET_BIT_SIZE * 2};
+}
+
 void MirageProtocol::dump(const MirageData &data) {
   ESP_LOGI(TAG, "Received Mirage: %s", format_hex_pretty(data.data).c_str());
 }
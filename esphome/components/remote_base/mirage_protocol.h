@@ -17,6 +17,7 @@ class MirageProtocol : public RemoteProtocol<MirageData> {
   void encode(RemoteTransmitData *dst, const MirageData &data) override;
   optional<MirageData> decode(RemoteReceiveData src) override;
   void dump(const MirageData &data) override;
+  RemoteHeader header() const override;
 
  protected:
   void encode_byte_(RemoteTransmitData *dst, uint8_t item);
@@ -93,6 +93,8 @@ optional<NECData> NECProtocol::decode(RemoteReceiveData src) {
   src.expect_mark(BIT_HIGH_US);
   return data;
 }
+RemoteHeader NECProtocol::header() const { return {HEADER_HIGH_US, HEADER_LOW_US, 2 + 32 * 2}; }
+
 void NECProtocol::dump(const NECData &data) {
   ESP_LOGI(TAG, "Received NEC: address=0x%04X, command=0x%04X command_repeats=%d", data.address, data.command,
            data.command_repeats);
@@ -66,6 +66,8 @@ optional<PanasonicData> PanasonicProtocol::decode(RemoteReceiveData src) {
 
   return out;
 }
+RemoteHeader PanasonicProtocol::header() const { return {HEADER_HIGH_US, HEADER_LOW_US, 2 + 48 * 2}; }
+
 void PanasonicProtocol::dump(const PanasonicData &data) {
   ESP_LOGI(TAG, "Received Panasonic: address=0x%04X, command=0x%08" PRIX32, data.address, data.command);
 }
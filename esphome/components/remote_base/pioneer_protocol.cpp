@@ -144,6 +144,8 @@ optional<PioneerData> PioneerProtocol::decode(RemoteReceiveData src) {
 
   return data;
 }
+RemoteHeader PioneerProtocol::header() const { return {HEADER_HIGH_US, HEADER_LOW_US, 2 + 32 * 2}; }
+
 void PioneerProtocol::dump(const PioneerData &data) {
   if (data.rc_code_2 == 0) {
     ESP_LOGI(TAG, "Received Pioneer: rc_code_X=0x%04X", data.rc_code_1);
@@ -17,6 +17,7 @@ class PioneerProtocol : public RemoteProtocol<PioneerData> {
   void encode(RemoteTransmitData *dst, const PioneerData &data) override;
   optional<PioneerData> decode(RemoteReceiveData src) override;
   void dump(const PioneerData &data) override;
+  RemoteHeader header() const override;
 };
 
 DECLARE_REMOTE_PROTOCOL(Pioneer)
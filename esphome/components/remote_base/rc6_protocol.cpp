@@ -172,6 +172,8 @@ optional<RC6Data> RC6Protocol::decode(RemoteReceiveData src) {
   return data;
 }
 
+RemoteHeader RC6Protocol::header() const { return {RC6_HEADER_MARK, RC6_HEADER_SPACE, 2}; }
+
 void RC6Protocol::dump(const RC6Data &data) {
   ESP_LOGI(RC6_TAG, "Received RC6: mode=0x%X, address=0x%02X, command=0x%02X, toggle=0x%X", data.mode, data.address,
            data.command, data.toggle);
@@ -57,6 +57,14 @@ bool RemoteReceiveData::peek_space_at_least(uint32_t length, uint32_t offset) co
   return value <= 0 && lo <= -value;
 }
 
+bool RemoteReceiveData::matches_header(const RemoteHeader &header) const {
+  if (this->data_.size() < header.min_size)
+    return false;
+  if (header.mark != 0 && !this->peek_mark(header.mark))
+    return false;
+  return header.space == 0 || this->peek_space(header.space, 1);
+}
+
 bool RemoteReceiveData::expect_mark(uint32_t length) {
   if (!this->peek_mark(length))
     return false;
@@ -108,18 +116,18 @@ void RemoteReceiverBase::register_dumper(RemoteReceiverDumperBase *dumper) {
 
 void RemoteReceiverBase::call_listeners_() {
   for (auto *listener : this->listeners_)
-    listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_));
+    listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_, &this->decode_cache_));
 }
 
 void RemoteReceiverBase::call_dumpers_() {
   bool success = false;
   for (auto *dumper : this->dumpers_) {
-    if (dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_)))
+    if (dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_, &this->decode_cache_)))
       success = true;
   }
   if (!success) {
     for (auto *dumper : this->secondary_dumpers_)
-      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_));
+      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_, &this->decode_cache_));
   }
 }
 
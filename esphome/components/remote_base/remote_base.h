@@ -1,3 +1,4 @@
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -22,6 +23,17 @@ enum ToleranceMode : uint8_t {
 
 using RawTimings = std::vector<int32_t>;
 
+class RemoteDecodeCache;
+
+/// Leading mark/space and minimum number of raw timings of a protocol's frames. Checked before
+/// decoding so that protocols which cannot match are skipped without scanning the frame.
+/// Zero fields match anything.
+struct RemoteHeader {
+  uint32_t mark;
+  uint32_t space;
+  uint32_t min_size;
+};
+
 class RemoteTransmitData {
  public:
   void mark(uint32_t length) { this->data_.push_back(length); }
@@ -47,8 +59,9 @@ class RemoteTransmitData {
 
 class RemoteReceiveData {
  public:
-  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode)
-      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode) {}
+  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode,
+                             RemoteDecodeCache *decode_cache = nullptr)
+      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode), decode_cache_(decode_cache) {}
 
   const RawTimings &get_raw_data() const { return this->data_; }
   uint32_t get_index() const { return index_; }
@@ -59,6 +72,7 @@ class RemoteReceiveData {
   bool peek_mark(uint32_t length, uint32_t offset = 0) const;
   bool peek_space(uint32_t length, uint32_t offset = 0) const;
   bool peek_space_at_least(uint32_t length, uint32_t offset = 0) const;
+  bool matches_header(const RemoteHeader &header) const;
   bool peek_item(uint32_t mark, uint32_t space, uint32_t offset = 0) const {
     return this->peek_space(space, offset + 1) && this->peek_mark(mark, offset);
   }
@@ -76,6 +90,7 @@ class RemoteReceiveData {
   }
   uint32_t get_tolerance() { return tolerance_; }
   ToleranceMode get_tolerance_mode() { return this->tolerance_mode_; }
+  RemoteDecodeCache *get_decode_cache() const { return this->decode_cache_; }
 
  protected:
   int32_t lower_bound_(uint32_t length) const {
@@ -99,8 +114,74 @@ class RemoteReceiveData {
   uint32_t index_;
   uint32_t tolerance_;
   ToleranceMode tolerance_mode_;
+  RemoteDecodeCache *decode_cache_;
 };
 
+/// Decode a protocol if the frame starts with its header.
+template<typename T> optional<typename T::ProtocolData> decode_if_header_matches(RemoteReceiveData src) {
+  T proto;
+  if (!src.matches_header(proto.header()))
+    return {};
+  return proto.decode(src);
+}
+
+/// Caches the result of each protocol decoder for the frame currently being dispatched, so that
+/// all binary sensors, triggers and dumpers of one protocol share a single decode pass.
+class RemoteDecodeCache {
+ public:
+  /// Invalidate all cached results, called once before a new frame is dispatched.
+  void next_frame() { this->frame_++; }
+
+  template<typename T> optional<typename T::ProtocolData> decode(RemoteReceiveData src) {
+    auto *slot = this->get_slot_<T>();
+    if (slot->frame != this->frame_) {
+      slot->value = decode_if_header_matches<T>(src);
+      slot->frame = this->frame_;
+    }
+    return slot->value;
+  }
+
+ protected:
+  struct SlotBase {
+    virtual ~SlotBase() = default;
+    const void *key;
+    uint32_t frame;
+  };
+  template<typename T> struct Slot : public SlotBase {
+    optional<typename T::ProtocolData> value;
+  };
+
+  /// Unique address per protocol type, used as the slot key.
+  template<typename T> static const void *key_() {
+    static const uint8_t KEY = 0;
+    return &KEY;
+  }
+
+  template<typename T> Slot<T> *get_slot_() {
+    const void *key = key_<T>();
+    for (auto &slot : this->slots_) {
+      if (slot->key == key)
+        return static_cast<Slot<T> *>(slot.get());
+    }
+    auto *slot = new Slot<T>();  // NOLINT(cppcoreguidelines-owning-memory)
+    slot->key = key;
+    slot->frame = this->frame_ - 1;
+    this->slots_.emplace_back(slot);
+    return slot;
+  }
+
+  std::vector<std::unique_ptr<SlotBase>> slots_;
+  uint32_t frame_{0};
+};
+
+/// Decode a protocol, sharing the result with other listeners of the same frame when possible.
+template<typename T> optional<typename T::ProtocolData> decode_protocol(RemoteReceiveData src) {
+  auto *cache = src.get_decode_cache();
+  if (cache == nullptr)
+    return decode_if_header_matches<T>(src);
+  return cache->decode<T>(src);
+}
+
 class RemoteComponentBase {
  public:
   explicit RemoteComponentBase(InternalGPIOPin *pin) : pin_(pin){};
@@ -216,6 +297,7 @@ class RemoteReceiverBase : public RemoteComponentBase {
   void call_listeners_();
   void call_dumpers_();
   void call_listeners_dumpers_() {
+    this->decode_cache_.next_frame();
     this->call_listeners_();
     this->call_dumpers_();
   }
@@ -224,6 +306,7 @@ class RemoteReceiverBase : public RemoteComponentBase {
   std::vector<RemoteReceiverDumperBase *> dumpers_;
   std::vector<RemoteReceiverDumperBase *> secondary_dumpers_;
   RawTimings temp_;
+  RemoteDecodeCache decode_cache_;
   uint32_t tolerance_{25};
   ToleranceMode tolerance_mode_{TOLERANCE_MODE_PERCENTAGE};
 };
@@ -246,6 +329,7 @@ template<typename T> class RemoteProtocol {
   virtual void encode(RemoteTransmitData *dst, const ProtocolData &data) = 0;
   virtual optional<ProtocolData> decode(RemoteReceiveData src) = 0;
   virtual void dump(const ProtocolData &data) = 0;
+  virtual RemoteHeader header() const { return {0, 0, 0}; }
 };
 
 template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBinarySensorBase {
@@ -254,8 +338,7 @@ template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBin
 
  protected:
   bool matches(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = decode_protocol<T>(src);
     return res.has_value() && *res == this->data_;
   }
 
@@ -270,8 +353,7 @@ template<typename T>
 class RemoteReceiverTrigger : public Trigger<typename T::ProtocolData>, public RemoteReceiverListener {
  protected:
   bool on_receive(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = decode_protocol<T>(src);
     if (res.has_value()) {
       this->trigger(*res);
       return true;
@@ -312,11 +394,10 @@ template<typename... Ts> class RemoteTransmitterActionBase : public RemoteTransm
 template<typename T> class RemoteReceiverDumper : public RemoteReceiverDumperBase {
  public:
   bool dump(RemoteReceiveData src) override {
-    auto proto = T();
-    auto decoded = proto.decode(src);
+    auto decoded = decode_protocol<T>(src);
     if (!decoded.has_value())
       return false;
-    proto.dump(*decoded);
+    T().dump(*decoded);
     return true;
   }
 };
@@ -95,6 +95,8 @@ optional<Samsung36Data> Samsung36Protocol::decode(RemoteReceiveData src) {
 
   return out;
 }
+RemoteHeader Samsung36Protocol::header() const { return {HEADER_HIGH_US, HEADER_LOW_US, NBITS}; }
+
 void Samsung36Protocol::dump(const Samsung36Data &data) {
   ESP_LOGI(TAG, "Received Samsung36: address=0x%04X, command=0x%08" PRIX32, data.address, data.command);
 }
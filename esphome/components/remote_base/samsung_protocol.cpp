@@ -57,6 +57,8 @@ optional<SamsungData> SamsungProtocol::decode(RemoteReceiveData src) {
     return {};
   return out;
 }
+RemoteHeader SamsungProtocol::header() const { return {HEADER_HIGH_US, HEADER_LOW_US, 2 + 31 * 2 + 1}; }
+
 void SamsungProtocol::dump(const SamsungData &data) {
   ESP_LOGI(TAG, "Received Samsung: data=0x%" PRIX64 ", nbits=%d", data.data, data.nbits);
 }
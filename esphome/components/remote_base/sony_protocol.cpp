@@ -61,6 +61,8 @@ optional<SonyData> SonyProtocol::decode(RemoteReceiveData src) {
 
   return out;
 }
+RemoteHeader SonyProtocol::header() const { return {HEADER_HIGH_US, HEADER_LOW_US, 2 + 12 * 2 - 1}; }
+
 void SonyProtocol::dump(const SonyData &data) {
   ESP_LOGI(TAG, "Received Sony: data=0x%08" PRIX32 ", nbits=%d", data.data, data.nbits);
 }
@@ -103,6 +103,8 @@ optional<ToshibaAcData> ToshibaAcProtocol::decode(RemoteReceiveData src) {
   return out;
 }
 
+RemoteHeader ToshibaAcProtocol::header() const { return {HEADER_HIGH_US, HEADER_LOW_US, 2 + 48 * 2}; }
+
 void ToshibaAcProtocol::dump(const ToshibaAcData &data) {
   if (data.rc_code_2 != 0) {
     ESP_LOGI(TAG, "Received Toshiba AC: rc_code_1=0x%" PRIX64 ", rc_code_2=0x%" PRIX64, data.rc_code_1, data.rc_code_2);
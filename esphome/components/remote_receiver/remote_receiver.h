@@ -16,17 +16,33 @@ namespace remote_receiver {
 struct RemoteReceiverComponentStore {
   static void gpio_intr(RemoteReceiverComponentStore *arg);
 
-  /// Stores the time (in micros) that the leading/falling edge happened at
-  ///  * An even index means a falling edge appeared at the time stored at the index
-  ///  * An uneven index means a rising edge appeared at the time stored at the index
-  volatile uint32_t *buffer{nullptr};
-  /// The position last written to
-  volatile uint32_t buffer_write_at;
-  /// The position last read from
-  uint32_t buffer_read_at{0};
-  bool overflow{false};
+  /// Entries at or above this value mark the first edge after an idle period. The lowest bit holds the level
+  /// the pin changed to, so the loop knows whether the frame starts with a mark or a space.
+  static const uint16_t FRAME_START = 0xFFFE;
+  /// Entries with this bit set (and below FRAME_START) hold the upper 15 bits of a long duration, the lower
+  /// 15 bits follow in the next entry.
+  static const uint16_t LONG_DURATION = 0x8000;
+
+  /// Stores the time (in micros) between two consecutive edges, the start of each frame and escaped long
+  /// durations, see FRAME_START and LONG_DURATION.
+  volatile uint16_t *buffer{nullptr};
+  /// The position the next entry is written to
+  volatile uint32_t buffer_write_at{0};
+  /// The position the next entry is read from
+  volatile uint32_t buffer_read_at{0};
   uint32_t buffer_size{1000};
+  /// Time (in micros) and level of the last accepted edge
+  volatile uint32_t last_change{0};
+  volatile bool last_level{false};
+  /// Set while edges are dropped because the buffer is full, cleared at the start of the next frame
+  volatile bool overflow{false};
+  /// Number of frame starts written by the ISR and consumed by the loop
+  volatile uint32_t frames_written{0};
+  uint32_t frames_read{0};
+  /// Number of edges dropped because the buffer was full
+  volatile uint32_t overflow_count{0};
   uint32_t filter_us{10};
+  uint32_t idle_us{10000};
   ISRInternalGPIOPin pin;
 };
 #elif defined(USE_ESP32) && ESP_IDF_VERSION_MAJOR >= 5
@@ -99,6 +115,10 @@ class RemoteReceiverComponent : public remote_base::RemoteReceiverBase,
   HighFrequencyLoopRequester high_freq_;
 #endif
 
+#if defined(USE_ESP8266) || defined(USE_LIBRETINY)
+  uint32_t overflow_reported_{0};
+#endif
+
   uint32_t buffer_size_{};
   uint32_t filter_us_{10};
   uint32_t idle_us_{10000};
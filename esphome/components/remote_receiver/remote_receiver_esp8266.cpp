@@ -12,22 +12,49 @@ static const char *const TAG = "remote_receiver.esp8266";
 
 void IRAM_ATTR HOT RemoteReceiverComponentStore::gpio_intr(RemoteReceiverComponentStore *arg) {
   const uint32_t now = micros();
-  // If the lhs is 1 (rising edge) we should write to an uneven index and vice versa
-  const uint32_t next = (arg->buffer_write_at + 1) % arg->buffer_size;
+  // Edges must alternate, a repeated level means we missed a short glitch
   const bool level = arg->pin.digital_read();
-  if (level != next % 2)
+  if (level == arg->last_level)
     return;
 
-  // If next is buffer_read, we have hit an overflow
-  if (next == arg->buffer_read_at)
-    return;
-
-  const uint32_t last_change = arg->buffer[arg->buffer_write_at];
-  const uint32_t time_since_change = now - last_change;
-  if (time_since_change <= arg->filter_us)
+  const uint32_t duration = now - arg->last_change;
+  if (duration <= arg->filter_us)
     return;
+  arg->last_change = now;
+  arg->last_level = level;
+
+  uint16_t entries[2];
+  uint32_t count = 1;
+  const bool frame_start = duration >= arg->idle_us;
+  if (frame_start) {
+    entries[0] = FRAME_START | level;
+  } else if (duration < LONG_DURATION) {
+    entries[0] = duration;
+  } else {
+    const uint32_t high = std::min<uint32_t>(duration >> 15, FRAME_START - LONG_DURATION - 1);
+    entries[0] = LONG_DURATION | high;
+    entries[1] = duration & 0x7FFF;
+    count = 2;
+  }
 
-  arg->buffer[arg->buffer_write_at = next] = now;
+  // After an overflow the rest of the frame is dropped, so that the next frame starts in sync
+  if (!arg->overflow || frame_start) {
+    uint32_t write_at = arg->buffer_write_at;
+    const uint32_t free = (arg->buffer_size + arg->buffer_read_at - write_at - 1) % arg->buffer_size;
+    if (free >= count) {
+      for (uint32_t i = 0; i < count; i++) {
+        arg->buffer[write_at] = entries[i];
+        write_at = (write_at + 1) % arg->buffer_size;
+      }
+      arg->buffer_write_at = write_at;
+      arg->overflow = false;
+      if (frame_start)
+        arg->frames_written++;
+      return;
+    }
+    arg->overflow = true;
+  }
+  arg->overflow_count++;
 }
 
 void RemoteReceiverComponent::setup() {
@@ -35,25 +62,20 @@ void RemoteReceiverComponent::setup() {
   this->pin_->setup();
   auto &s = this->store_;
   s.filter_us = this->filter_us_;
+  s.idle_us = this->idle_us_;
   s.pin = this->pin_->to_isr();
-  s.buffer_size = this->buffer_size_;
+  // Durations are stored as 16 bit entries, so each configured slot holds two of them
+  s.buffer_size = this->buffer_size_ * 2;
 
   this->high_freq_.start();
-  if (s.buffer_size % 2 != 0) {
-    // Make sure divisible by two. This way, we know that every 0bxxx0 index is a space and every 0bxxx1 index is a mark
-    s.buffer_size++;
-  }
 
-  s.buffer = new uint32_t[s.buffer_size];
+  s.buffer = new uint16_t[s.buffer_size];
   void *buf = (void *) s.buffer;
-  memset(buf, 0, s.buffer_size * sizeof(uint32_t));
+  memset(buf, 0, s.buffer_size * sizeof(uint16_t));
 
-  // First index is a space.
-  if (this->pin_->digital_read()) {
-    s.buffer_write_at = s.buffer_read_at = 1;
-  } else {
-    s.buffer_write_at = s.buffer_read_at = 0;
-  }
+  // Treat the first edge as the start of a frame
+  s.last_level = this->pin_->digital_read();
+  s.last_change = micros() - this->idle_us_;
   this->pin_->attach_interrupt(RemoteReceiverComponentStore::gpio_intr, &this->store_, gpio::INTERRUPT_ANY_EDGE);
 }
 void RemoteReceiverComponent::dump_config() {
@@ -73,45 +95,52 @@ void RemoteReceiverComponent::dump_config() {
 void RemoteReceiverComponent::loop() {
   auto &s = this->store_;
 
+  const uint32_t overflow_count = s.overflow_count;
+  if (overflow_count != this->overflow_reported_) {
+    ESP_LOGW(TAG, "Buffer overflow, dropped %" PRIu32 " edges", overflow_count - this->overflow_reported_);
+    this->overflow_reported_ = overflow_count;
+  }
+
   // copy write at to local variables, as it's volatile
   const uint32_t write_at = s.buffer_write_at;
-  const uint32_t dist = (s.buffer_size + write_at - s.buffer_read_at) % s.buffer_size;
-  // signals must at least one rising and one leading edge
-  if (dist <= 1)
+  uint32_t read_at = s.buffer_read_at;
+  if (read_at == write_at)
     return;
-  const uint32_t now = micros();
-  if (now - s.buffer[write_at] < this->idle_us_) {
-    // The last change was fewer than the configured idle time ago.
+  // A frame is complete once the next frame has started or there were no changes for the configured idle time
+  if (s.frames_written - s.frames_read < 2 && micros() - s.last_change < this->idle_us_)
     return;
-  }
 
-  ESP_LOGVV(TAG, "read_at=%u write_at=%u dist=%u now=%u end=%u", s.buffer_read_at, write_at, dist, now,
-            s.buffer[write_at]);
+  ESP_LOGVV(TAG, "read_at=%u write_at=%u", read_at, write_at);
 
-  // Skip first value, it's from the previous idle level
-  s.buffer_read_at = (s.buffer_read_at + 1) % s.buffer_size;
-  uint32_t prev = s.buffer_read_at;
-  s.buffer_read_at = (s.buffer_read_at + 1) % s.buffer_size;
-  const uint32_t reserve_size = 1 + (s.buffer_size + write_at - s.buffer_read_at) % s.buffer_size;
   this->temp_.clear();
-  this->temp_.reserve(reserve_size);
-  int32_t multiplier = s.buffer_read_at % 2 == 0 ? 1 : -1;
-
-  for (uint32_t i = 0; prev != write_at; i++) {
-    int32_t delta = s.buffer[s.buffer_read_at] - s.buffer[prev];
-    if (uint32_t(delta) >= this->idle_us_) {
-      // already found a space longer than idle. There must have been two pulses
-      break;
+  int32_t multiplier = 0;
+  while (read_at != write_at) {
+    uint32_t value = s.buffer[read_at];
+    if (value >= RemoteReceiverComponentStore::FRAME_START) {
+      if (multiplier != 0)
+        break;
+      // The level after the first edge decides whether the frame starts with a mark or a space
+      multiplier = (value & 1) ? 1 : -1;
+      s.frames_read++;
+      read_at = (read_at + 1) % s.buffer_size;
+      continue;
+    }
+    read_at = (read_at + 1) % s.buffer_size;
+    if (value & RemoteReceiverComponentStore::LONG_DURATION) {
+      value = ((value & ~RemoteReceiverComponentStore::LONG_DURATION) << 15) | s.buffer[read_at];
+      read_at = (read_at + 1) % s.buffer_size;
     }
+    if (multiplier == 0)
+      continue;
 
-    ESP_LOGVV(TAG, "  i=%u buffer[%u]=%u - buffer[%u]=%u -> %d", i, s.buffer_read_at, s.buffer[s.buffer_read_at], prev,
-              s.buffer[prev], multiplier * delta);
-    this->temp_.push_back(multiplier * delta);
-    prev = s.buffer_read_at;
-    s.buffer_read_at = (s.buffer_read_at + 1) % s.buffer_size;
+    ESP_LOGVV(TAG, "  %" PRId32, multiplier * int32_t(value));
+    this->temp_.push_back(multiplier * int32_t(value));
     multiplier *= -1;
   }
-  s.buffer_read_at = (s.buffer_size + s.buffer_read_at - 1) % s.buffer_size;
+  s.buffer_read_at = read_at;
+  // signals must at least one rising and one leading edge
+  if (this->temp_.empty())
+    return;
   this->temp_.push_back(this->idle_us_ * multiplier);
 
   this->call_listeners_dumpers_();
@@ -188,35 +188,43 @@ void SSD1306::setup() {
   this->turn_on();
 }
 void SSD1306::display() {
+  const size_t width = this->get_width_internal();
+  // Only send the columns of each page that changed since the last update
+  this->diff_buffer_rows_(this->get_height_internal() / 8, width,
+                          [this, width](size_t page, size_t start, size_t length) {
+                            this->set_page_window_(page, start, length);
+                            this->write_display_data(this->buffer_ + page * width + start, length);
+                          });
+}
+void SSD1306::set_page_window_(uint8_t page, uint8_t column, uint8_t length) {
   if (this->is_sh1106_() || this->is_sh1107_()) {
-    this->write_display_data();
+    // SH1106 displays start at column 2 for historical reasons, SH1107 use column 0
+    uint8_t start = column + (this->is_sh1106_() ? 2 : 0);
+    this->command(0xB0 + page);            // row
+    this->command(0x00 | (start & 0x0F));  // lower column
+    this->command(0x10 | (start >> 4));    // higher column
     return;
   }
 
-  this->command(SSD1306_COMMAND_COLUMN_ADDRESS);
+  uint8_t start = column + this->offset_x_;
   switch (this->model_) {
     case SSD1306_MODEL_64_48:
     case SSD1306_MODEL_64_32:
-      this->command(0x20 + this->offset_x_);
-      this->command(0x20 + this->offset_x_ + this->get_width_internal() - 1);
+      start += 0x20;
       break;
     case SSD1306_MODEL_72_40:
-      this->command(0x1C + this->offset_x_);
-      this->command(0x1C + this->offset_x_ + this->get_width_internal() - 1);
+      start += 0x1C;
       break;
     default:
-      this->command(0 + this->offset_x_);  // Page start address, 0
-      this->command(this->get_width_internal() + this->offset_x_ - 1);
       break;
   }
+  this->command(SSD1306_COMMAND_COLUMN_ADDRESS);
+  this->command(start);
+  this->command(start + length - 1);
 
   this->command(SSD1306_COMMAND_PAGE_ADDRESS);
-  // Page start address, 0
-  this->command(0);
-  // Page end address:
-  this->command((this->get_height_internal() / 8) - 1);
-
-  this->write_display_data();
+  this->command(page);
+  this->command(page);
 }
 bool SSD1306::is_sh1106_() const {
   return this->model_ == SH1106_MODEL_96_16 || this->model_ == SH1106_MODEL_128_32 ||
@@ -328,6 +336,23 @@ void HOT SSD1306::draw_absolute_pixel_internal(int x, int y, Color color) {
     this->buffer_[pos] &= ~(1 << subpos);
   }
 }
+void HOT SSD1306::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  // every byte holds a vertical strip of 8 pixels, so fill page by page with a mask of the affected rows
+  const int y2 = y + height;
+  for (int page = y / 8; page * 8 < y2; page++) {
+    const int row_start = std::max(y, page * 8) - page * 8;
+    const int row_end = std::min(y2, page * 8 + 8) - page * 8;
+    const uint8_t mask = (0xFF >> (8 - (row_end - row_start))) << row_start;
+    uint8_t *ptr = this->buffer_ + x + page * this->get_width_internal();
+    if (color.is_on()) {
+      for (int i = 0; i != width; i++)
+        *ptr++ |= mask;
+    } else {
+      for (int i = 0; i != width; i++)
+        *ptr++ &= ~mask;
+    }
+  }
+}
 void SSD1306::fill(Color color) {
   uint8_t fill = color.is_on() ? 0xFF : 0x00;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
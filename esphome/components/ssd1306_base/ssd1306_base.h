@@ -57,14 +57,18 @@ class SSD1306 : public display::DisplayBuffer {
 
  protected:
   virtual void command(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /// Write length bytes of display data to the window set by set_page_window_().
+  virtual void write_display_data(const uint8_t *data, size_t length) = 0;
   void init_reset_();
+  /// Set up the controller to receive length bytes for the given page, starting at the given column.
+  void set_page_window_(uint8_t page, uint8_t column, uint8_t length);
 
   bool is_sh1106_() const;
   bool is_sh1107_() const;
   bool is_ssd1305_() const;
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x, int y, int width, int height, Color color) override;
 
   int get_height_internal() override;
   int get_width_internal() override;
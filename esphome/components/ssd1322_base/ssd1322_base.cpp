@@ -111,15 +111,27 @@ void SSD1322::setup() {
   this->turn_on();           // display ON
 }
 void SSD1322::display() {
+  // Only send the rows that changed since the last update
+  const size_t row_length = this->get_width_internal() / SSD1322_PIXELSPERBYTE;
+  int first_row = -1;
+  int last_row = -1;
+  this->diff_buffer_rows_(this->get_height_internal(), row_length, [&](size_t row, size_t, size_t) {
+    if (first_row < 0)
+      first_row = row;
+    last_row = row;
+  });
+  if (first_row < 0)
+    return;
+
   this->command(SSD1322_SETCOLUMNADDRESS);  // set column address
   this->data(0x1C);                         // set column start address
   this->data(0x5B);                         // set column end address
   this->command(SSD1322_SETROWADDRESS);     // set row address
-  this->data(0x00);                         // set row start address
-  this->data(0x3F);                         // set last row
+  this->data(first_row);                    // set row start address
+  this->data(last_row);                     // set last row
   this->command(SSD1322_WRITERAM);          // write
 
-  this->write_display_data();
+  this->write_display_data(this->buffer_ + first_row * row_length, (last_row - first_row + 1) * row_length);
 }
 void SSD1322::update() {
   this->do_update_();
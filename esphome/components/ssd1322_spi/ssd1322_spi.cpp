@@ -53,7 +53,7 @@ void SPISSD1322::data(uint8_t value) {
     this->cs_->digital_write(true);
   this->disable();
 }
-void HOT SPISSD1322::write_display_data() {
+void HOT SPISSD1322::write_display_data(const uint8_t *data, size_t length) {
   if (this->cs_)
     this->cs_->digital_write(true);
   this->dc_pin_->digital_write(true);
@@ -61,7 +61,7 @@ void HOT SPISSD1322::write_display_data() {
     this->cs_->digital_write(false);
   delay(1);
   this->enable();
-  this->write_array(this->buffer_, this->get_buffer_length_());
+  this->write_array(data, length);
   if (this->cs_)
     this->cs_->digital_write(true);
   this->disable();
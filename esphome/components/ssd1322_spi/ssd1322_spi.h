@@ -21,7 +21,7 @@ class SPISSD1322 : public ssd1322_base::SSD1322,
   void command(uint8_t value) override;
   void data(uint8_t value) override;
 
-  void write_display_data() override;
+  void write_display_data(const uint8_t *data, size_t length) override;
 
   GPIOPin *dc_pin_;
 };
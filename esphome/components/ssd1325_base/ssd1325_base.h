@@ -39,7 +39,8 @@ class SSD1325 : public display::DisplayBuffer {
 
  protected:
   virtual void command(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /// Write length bytes of display data to the window set up by display().
+  virtual void write_display_data(const uint8_t *data, size_t length) = 0;
   void init_reset_();
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
@@ -85,14 +85,26 @@ void SSD1327::setup() {
   this->turn_on();           // display ON
 }
 void SSD1327::display() {
+  // Only send the rows that changed since the last update
+  const size_t row_length = this->get_width_internal() / SSD1327_PIXELSPERBYTE;
+  int first_row = -1;
+  int last_row = -1;
+  this->diff_buffer_rows_(this->get_height_internal(), row_length, [&](size_t row, size_t, size_t) {
+    if (first_row < 0)
+      first_row = row;
+    last_row = row;
+  });
+  if (first_row < 0)
+    return;
+
   this->command(SSD1327_SETCOLUMNADDRESS);  // set column address
   this->command(0x00);                      // set column start address
   this->command(0x3F);                      // set column end address
   this->command(SSD1327_SETROWADDRESS);     // set row address
-  this->command(0x00);                      // set row start address
-  this->command(127);                       // set last row
+  this->command(first_row);                 // set row start address
+  this->command(last_row);                  // set last row
 
-  this->write_display_data();
+  this->write_display_data(this->buffer_ + first_row * row_length, (last_row - first_row + 1) * row_length);
 }
 void SSD1327::update() {
   if (!this->is_failed()) {
@@ -31,13 +31,10 @@ void I2CSSD1327::dump_config() {
   }
 }
 void I2CSSD1327::command(uint8_t value) { this->write_byte(0x00, value); }
-void HOT I2CSSD1327::write_display_data() {
-  for (uint32_t i = 0; i < this->get_buffer_length_();) {
-    uint8_t data[16];
-    for (uint8_t &j : data)
-      j = this->buffer_[i++];
-    this->write_bytes(0x40, data, sizeof(data));
-  }
+void HOT I2CSSD1327::write_display_data(const uint8_t *data, size_t length) {
+  static const size_t BLOCK_SIZE = 16;
+  for (size_t i = 0; i < length; i += BLOCK_SIZE)
+    this->write_bytes(0x40, data + i, std::min(BLOCK_SIZE, length - i));
 }
 
 }  // namespace ssd1327_i2c
@@ -14,7 +14,7 @@ class I2CSSD1327 : public ssd1327_base::SSD1327, public i2c::I2CDevice {
 
  protected:
   void command(uint8_t value) override;
-  void write_display_data() override;
+  void write_display_data(const uint8_t *data, size_t length) override;
 
   enum ErrorCode { NONE = 0, COMMUNICATION_FAILED } error_code_{NONE};
 };
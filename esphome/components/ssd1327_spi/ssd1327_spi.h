@@ -20,7 +20,7 @@ class SPISSD1327 : public ssd1327_base::SSD1327,
  protected:
   void command(uint8_t value) override;
 
-  void write_display_data() override;
+  void write_display_data(const uint8_t *data, size_t length) override;
 
   GPIOPin *dc_pin_;
 };
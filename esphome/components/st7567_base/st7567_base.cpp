@@ -16,7 +16,7 @@ void ST7567::display_init_() {
   ESP_LOGD(TAG, "Initializing ST7567 display...");
   this->display_init_registers_();
   this->clear();
-  this->write_display_data();
+  this->write_changed_pages_();
   this->command(ST7567_DISPLAY_ON);
 }
 
@@ -44,6 +44,7 @@ void ST7567::display_init_registers_() {
 void ST7567::display_sw_refresh_() {
   ESP_LOGD(TAG, "Performing refresh sequence...");
   this->command(ST7567_SW_REFRESH);
+  this->invalidate_shadow_buffer_();
   this->display_init_registers_();
 }
 
@@ -58,7 +59,25 @@ void ST7567::update() {
     this->refresh_requested_ = false;
     this->display_sw_refresh_();
   }
-  this->write_display_data();
+  this->write_changed_pages_();
+}
+
+void ST7567::write_changed_pages_() {
+  // ST7567A has built-in RAM with 132x65 bit capacity which stores the display data.
+  // but only first 128 pixels from each line are shown on screen
+  // if screen got flipped horizontally then it shows last 128 pixels,
+  // so we need to write x coordinate starting from column 4, not column 0
+  this->command(ST7567_SET_START_LINE + this->start_line_);
+  const size_t width = this->get_width_internal();
+  // Only send the columns of each page that changed since the last update
+  this->diff_buffer_rows_(this->get_height_internal() / 8, width,
+                          [this, width](size_t page, size_t start, size_t length) {
+                            uint8_t column = start + this->get_offset_x_();
+                            this->command(ST7567_PAGE_ADDR + page);              // Set Page
+                            this->command(ST7567_COL_ADDR_H + (column >> 4));    // Set MSB Column address
+                            this->command(ST7567_COL_ADDR_L + (column & 0x0F));  // Set LSB Column address
+                            this->write_display_data(this->buffer_ + page * width + start, length);
+                          });
 }
 
 void ST7567::set_all_pixels_on(bool enable) {
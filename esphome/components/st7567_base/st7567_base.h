@@ -65,12 +65,14 @@ class ST7567 : public display::DisplayBuffer {
 
  protected:
   virtual void command(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /// Write length bytes of display data at the current page and column.
+  virtual void write_display_data(const uint8_t *data, size_t length) = 0;
 
   void init_reset_();
   void display_init_();
   void display_init_registers_();
   void display_sw_refresh_();
+  void write_changed_pages_();
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
 
@@ -36,23 +36,11 @@ void I2CST7567::dump_config() {
 
 void I2CST7567::command(uint8_t value) { this->write_byte(0x00, value); }
 
-void HOT I2CST7567::write_display_data() {
-  // ST7567A has built-in RAM with 132x65 bit capacity which stores the display data.
-  // but only first 128 pixels from each line are shown on screen
-  // if screen got flipped horizontally then it shows last 128 pixels,
-  // so we need to write x coordinate starting from column 4, not column 0
-  this->command(esphome::st7567_base::ST7567_SET_START_LINE + this->start_line_);
-  for (uint8_t y = 0; y < (uint8_t) this->get_height_internal() / 8; y++) {
-    this->command(esphome::st7567_base::ST7567_PAGE_ADDR + y);                       // Set Page
-    this->command(esphome::st7567_base::ST7567_COL_ADDR_H);                          // Set MSB Column address
-    this->command(esphome::st7567_base::ST7567_COL_ADDR_L + this->get_offset_x_());  // Set LSB Column address
-
-    static const size_t BLOCK_SIZE = 64;
-    for (uint8_t x = 0; x < (uint8_t) this->get_width_internal(); x += BLOCK_SIZE) {
-      this->write_register(esphome::st7567_base::ST7567_SET_START_LINE, &buffer_[y * this->get_width_internal() + x],
-                           this->get_width_internal() - x > BLOCK_SIZE ? BLOCK_SIZE : this->get_width_internal() - x,
-                           true);
-    }
+void HOT I2CST7567::write_display_data(const uint8_t *data, size_t length) {
+  static const size_t BLOCK_SIZE = 64;
+  for (size_t i = 0; i < length; i += BLOCK_SIZE) {
+    this->write_register(esphome::st7567_base::ST7567_SET_START_LINE, data + i, std::min(BLOCK_SIZE, length - i),
+                         true);
   }
 }
 
@@ -43,23 +43,11 @@ void SPIST7567::command(uint8_t value) {
   this->disable();
 }
 
-void HOT SPIST7567::write_display_data() {
-  // ST7567A has built-in RAM with 132x65 bit capacity which stores the display data.
-  // but only first 128 pixels from each line are shown on screen
-  // if screen got flipped horizontally then it shows last 128 pixels,
-  // so we need to write x coordinate starting from column 4, not column 0
-  this->command(esphome::st7567_base::ST7567_SET_START_LINE + this->start_line_);
-  for (uint8_t y = 0; y < (uint8_t) this->get_height_internal() / 8; y++) {
-    this->dc_pin_->digital_write(false);
-    this->command(esphome::st7567_base::ST7567_PAGE_ADDR + y);                       // Set Page
-    this->command(esphome::st7567_base::ST7567_COL_ADDR_H);                          // Set MSB Column address
-    this->command(esphome::st7567_base::ST7567_COL_ADDR_L + this->get_offset_x_());  // Set LSB Column address
-    this->dc_pin_->digital_write(true);
-
-    this->enable();
-    this->write_array(&this->buffer_[y * this->get_width_internal()], this->get_width_internal());
-    this->disable();
-  }
+void HOT SPIST7567::write_display_data(const uint8_t *data, size_t length) {
+  this->dc_pin_->digital_write(true);
+  this->enable();
+  this->write_array(data, length);
+  this->disable();
 }
 
 }  // namespace st7567_spi
@@ -20,7 +20,7 @@ class SPIST7567 : public st7567_base::ST7567,
  protected:
   void command(uint8_t value) override;
 
-  void write_display_data() override;
+  void write_display_data(const uint8_t *data, size_t length) override;
 
   GPIOPin *dc_pin_;
 };
@@ -289,6 +289,8 @@ void ST7735::setup() {
 
   this->init_internal_(this->get_buffer_length());
   memset(this->buffer_, 0x00, this->get_buffer_length());
+  // the display RAM holds whatever it powered up with, so the first update sends the whole buffer
+  this->dirty_regions_.add(0, 0, this->get_width_internal(), this->get_height_internal());
 }
 
 void ST7735::update() {
@@ -312,15 +314,23 @@ void HOT ST7735::draw_absolute_pixel_internal(int x, int y, Color color) {
     return;
 
   if (this->eightbitcolor_) {
-    const uint32_t color332 = display::ColorUtil::color_to_332(color);
+    const uint8_t color332 = display::ColorUtil::color_to_332(color);
     uint16_t pos = (x + y * this->get_width_internal());
+    if (this->buffer_[pos] == color332)
+      return;
     this->buffer_[pos] = color332;
   } else {
     const uint32_t color565 = display::ColorUtil::color_to_565(color);
+    const uint8_t hi_byte = (color565 >> 8) & 0xff;
+    const uint8_t lo_byte = color565 & 0xff;
     uint16_t pos = (x + y * this->get_width_internal()) * 2;
-    this->buffer_[pos++] = (color565 >> 8) & 0xff;
-    this->buffer_[pos] = color565 & 0xff;
+    if (this->buffer_[pos] == hi_byte && this->buffer_[pos + 1] == lo_byte)
+      return;
+    this->buffer_[pos++] = hi_byte;
+    this->buffer_[pos] = lo_byte;
   }
+  // tracking the changed regions may speed up drawing from buffer
+  this->dirty_regions_.add(x, y);
 }
 
 void ST7735::init_reset_() {
@@ -418,13 +428,21 @@ void HOT ST7735::senddata_(const uint8_t *data_bytes, uint8_t num_data_bytes) {
 }
 
 void HOT ST7735::write_display_data_() {
+  // only the regions changed since the last update are sent, each with its own address window
+  for (const auto &region : this->dirty_regions_)
+    this->write_region_(region);
+  this->dirty_regions_.clear();
+}
+
+void HOT ST7735::write_region_(const display::Rect &region) {
   uint16_t offsetx = colstart_;
   uint16_t offsety = rowstart_;
 
-  uint16_t x1 = offsetx;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = offsety;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  uint16_t x1 = offsetx + region.x;
+  uint16_t x2 = x1 + region.w - 1;
+  uint16_t y1 = offsety + region.y;
+  uint16_t y2 = y1 + region.h - 1;
+  const int width = this->get_width_internal();
 
   this->enable();
 
@@ -446,9 +464,10 @@ void HOT ST7735::write_display_data_() {
   this->dc_pin_->digital_write(true);
 
   if (this->eightbitcolor_) {
-    for (size_t line = 0; line < this->get_buffer_length(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
-        auto color332 = display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
+    for (int line = region.y; line != region.y2(); line++) {
+      for (int index = region.x; index != region.x2(); ++index) {
+        auto color332 = display::ColorUtil::to_color(this->buffer_[index + line * width],
+                                                     display::ColorOrder::COLOR_ORDER_RGB,
                                                      display::ColorBitness::COLOR_BITNESS_332, true);
 
         auto color = display::ColorUtil::color_to_565(color332);
@@ -457,8 +476,12 @@ void HOT ST7735::write_display_data_() {
         this->write_byte(color & 0xff);
       }
     }
+  } else if (region.w == width) {
+    // whole rows follow each other in the buffer
+    this->write_array(this->buffer_ + region.y * width * 2, size_t(region.h) * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length());
+    for (int line = region.y; line != region.y2(); line++)
+      this->write_array(this->buffer_ + (line * width + region.x) * 2, region.w * 2);
   }
   this->disable();
 }
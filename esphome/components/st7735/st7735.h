@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/components/spi/spi.h"
 #include "esphome/components/display/display_buffer.h"
+#include "esphome/components/display/dirty_regions.h"
 
 namespace esphome {
 namespace st7735 {
@@ -62,6 +63,8 @@ class ST7735 : public display::DisplayBuffer,
   void writedata_(uint8_t value);
 
   void write_display_data_();
+  /// Send the part of the buffer within region to the display.
+  void write_region_(const display::Rect &region);
 
   void init_reset_();
   void display_init_(const uint8_t *addr);
@@ -81,6 +84,7 @@ class ST7735 : public display::DisplayBuffer,
   bool usebgr_ = false;
   bool invert_colors_ = false;
   int16_t width_ = 80, height_ = 80;  // Watch heap size
+  display::DirtyRegions dirty_regions_{};
 
   GPIOPin *reset_pin_{nullptr};
   GPIOPin *dc_pin_{nullptr};
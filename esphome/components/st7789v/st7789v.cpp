@@ -149,10 +149,18 @@ void ST7789V::update() {
 void ST7789V::set_model_str(const char *model_str) { this->model_str_ = model_str; }
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = this->offset_height_;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = this->offset_width_;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  // only the regions changed since the last update are sent, each with its own address window
+  for (const auto &region : this->dirty_regions_)
+    this->write_region_(region);
+  this->dirty_regions_.clear();
+}
+
+void ST7789V::write_region_(const display::Rect &region) {
+  uint16_t x1 = this->offset_height_ + region.x;
+  uint16_t x2 = x1 + region.w - 1;
+  uint16_t y1 = this->offset_width_ + region.y;
+  uint16_t y2 = y1 + region.h - 1;
+  const int width = this->get_width_internal();
 
   this->enable();
 
@@ -174,11 +182,11 @@ void ST7789V::write_display_data() {
   if (this->eightbitcolor_) {
     uint8_t temp_buffer[TEMP_BUFFER_SIZE];
     size_t temp_index = 0;
-    for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
-        auto color = display::ColorUtil::color_to_565(
-            display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
-                                         display::ColorBitness::COLOR_BITNESS_332, true));
+    for (int line = region.y; line != region.y2(); line++) {
+      const uint8_t *row = this->buffer_ + line * width + region.x;
+      for (int index = 0; index < region.w; ++index) {
+        auto color = display::ColorUtil::color_to_565(display::ColorUtil::to_color(
+            row[index], display::ColorOrder::COLOR_ORDER_RGB, display::ColorBitness::COLOR_BITNESS_332, true));
         temp_buffer[temp_index++] = (uint8_t) (color >> 8);
         temp_buffer[temp_index++] = (uint8_t) color;
         if (temp_index == TEMP_BUFFER_SIZE) {
@@ -189,8 +197,12 @@ void ST7789V::write_display_data() {
     }
     if (temp_index != 0)
       this->write_array(temp_buffer, temp_index);
+  } else if (region.w == width) {
+    // whole rows follow each other in the buffer
+    this->write_array(this->buffer_ + region.y * width * 2, size_t(region.h) * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    for (int line = region.y; line != region.y2(); line++)
+      this->write_array(this->buffer_ + (line * width + region.x) * 2, region.w * 2);
   }
 
   this->disable();
@@ -293,16 +305,116 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
     return;
 
+  int low, high;
+  if (this->fill_row_(x, y, 1, this->to_buffer_color_(color), low, high)) {
+    // tracking the changed regions may speed up drawing from buffer
+    this->dirty_regions_.add(x, y);
+  }
+}
+
+uint16_t ST7789V::to_buffer_color_(Color color) {
+  if (this->eightbitcolor_)
+    return display::ColorUtil::color_to_332(color);
+  return display::ColorUtil::color_to_565(color);
+}
+
+bool HOT ST7789V::fill_row_(int x, int y, int width, uint16_t buffer_color, int &low, int &high) {
+  low = x + width;
+  high = -1;
   if (this->eightbitcolor_) {
-    auto color332 = display::ColorUtil::color_to_332(color);
-    uint32_t pos = (x + y * this->get_width_internal());
-    this->buffer_[pos] = color332;
+    const uint8_t color332 = buffer_color;
+    uint8_t *ptr = this->buffer_ + x + y * this->get_width_internal();
+    for (int i = x; i != x + width; i++, ptr++) {
+      if (*ptr != color332) {
+        *ptr = color332;
+        low = std::min(low, i);
+        high = i;
+      }
+    }
   } else {
-    auto color565 = display::ColorUtil::color_to_565(color);
-    uint32_t pos = (x + y * this->get_width_internal()) * 2;
-    this->buffer_[pos++] = (color565 >> 8) & 0xff;
-    this->buffer_[pos] = color565 & 0xff;
+    const uint8_t hi_byte = (buffer_color >> 8) & 0xff;
+    const uint8_t lo_byte = buffer_color & 0xff;
+    uint8_t *ptr = this->buffer_ + (x + y * this->get_width_internal()) * 2;
+    for (int i = x; i != x + width; i++, ptr += 2) {
+      if (ptr[0] != hi_byte || ptr[1] != lo_byte) {
+        ptr[0] = hi_byte;
+        ptr[1] = lo_byte;
+        low = std::min(low, i);
+        high = i;
+      }
+    }
+  }
+  return high >= 0;
+}
+
+void HOT ST7789V::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  const uint16_t buffer_color = this->to_buffer_color_(color);
+  // track the area actually changed, so the dirty regions stay as tight as with single pixel writes
+  int x_low = x + width;
+  int x_high = -1;
+  int y_low = y + height;
+  int y_high = -1;
+  for (int j = y; j != y + height; j++) {
+    int row_low, row_high;
+    if (this->fill_row_(x, j, width, buffer_color, row_low, row_high)) {
+      x_low = std::min(x_low, row_low);
+      x_high = std::max(x_high, row_high);
+      y_low = std::min(y_low, j);
+      y_high = j;
+    }
+  }
+  if (x_high >= 0)
+    this->dirty_regions_.add(x_low, y_low, x_high - x_low + 1, y_high - y_low + 1);
+}
+
+void HOT ST7789V::draw_absolute_alpha_bitmap_internal(int x, int y, int width, int height, const uint8_t *data,
+                                                      uint8_t bpp, Color color, Color background) {
+  // blending and converting is the expensive part, so it is done once per pixel value for fonts of up to 4 bpp
+  uint16_t colors[16];
+  uint16_t converted = 0;
+  int x_low = x + width;
+  int x_high = -1;
+  int y_low = y + height;
+  int y_high = -1;
+  decode_alpha_bitmap_(x, y, width, height, data, bpp, [&](int run_x, int run_y, int length, uint8_t pixel) {
+    uint16_t buffer_color;
+    if (pixel >= 16) {
+      buffer_color = this->to_buffer_color_(blend_alpha_(pixel, bpp, color, background));
+    } else {
+      if ((converted & (1 << pixel)) == 0) {
+        colors[pixel] = this->to_buffer_color_(blend_alpha_(pixel, bpp, color, background));
+        converted |= 1 << pixel;
+      }
+      buffer_color = colors[pixel];
+    }
+    int row_low, row_high;
+    if (this->fill_row_(run_x, run_y, length, buffer_color, row_low, row_high)) {
+      x_low = std::min(x_low, row_low);
+      x_high = std::max(x_high, row_high);
+      y_low = std::min(y_low, run_y);
+      y_high = run_y;
+    }
+  });
+  if (x_high >= 0)
+    this->dirty_regions_.add(x_low, y_low, x_high - x_low + 1, y_high - y_low + 1);
+}
+
+void HOT ST7789V::draw_absolute_rgb565_internal(int x, int y, int width, int height, const uint8_t *data,
+                                                size_t stride) {
+  if (this->eightbitcolor_) {
+    display::DisplayBuffer::draw_absolute_rgb565_internal(x, y, width, height, data, stride);
+    return;
+  }
+  int y_low = y + height;
+  int y_high = -1;
+  for (int j = y; j != y + height; j++, data += stride) {
+    if (copy_row_(this->buffer_ + (x + j * this->get_width_internal()) * 2, data, width * 2)) {
+      y_low = std::min(y_low, j);
+      y_high = j;
+    }
   }
+  if (y_high >= 0)
+    this->dirty_regions_.add(x, y_low, width, y_high - y_low + 1);
 }
 
 }  // namespace st7789v
@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/components/spi/spi.h"
 #include "esphome/components/display/display_buffer.h"
+#include "esphome/components/display/dirty_regions.h"
 #ifdef USE_POWER_SUPPLY
 #include "esphome/components/power_supply/power_supply.h"
 #endif
@@ -164,6 +165,20 @@ class ST7789V : public display::DisplayBuffer,
   void draw_filled_rect_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x, int y, int width, int height, Color color) override;
+  void draw_absolute_rgb565_internal(int x, int y, int width, int height, const uint8_t *data, size_t stride) override;
+  void draw_absolute_alpha_bitmap_internal(int x, int y, int width, int height, const uint8_t *data, uint8_t bpp,
+                                           Color color, Color background) override;
+  /// Convert color to the format of the buffer, as written by fill_row_().
+  uint16_t to_buffer_color_(Color color);
+  /** Fill width pixels of row y from column x with buffer_color. Returns whether any pixel changed, and the first
+   * and last changed column in low and high.
+   */
+  bool fill_row_(int x, int y, int width, uint16_t buffer_color, int &low, int &high);
+  /// Send the part of the buffer within region to the display.
+  void write_region_(const display::Rect &region);
+
+  display::DirtyRegions dirty_regions_{};
 
   const char *model_str_;
 };
@@ -169,6 +169,9 @@ MODELS = {
 }
 
 RESET_PIN_REQUIRED_MODELS = ("2.13inv2", "2.13in-ttgo-b74")
+PARTIAL_WINDOW_UNSUPPORTED_MODELS = ("2.13inv2", "2.13in-ttgo-b1")
+
+CONF_PARTIAL_WINDOW = "partial_window"
 
 
 def validate_full_update_every_only_types_ac(value):
@@ -186,6 +189,23 @@ def validate_full_update_every_only_types_ac(value):
     return value
 
 
+def validate_partial_window(config):
+    if not config.get(CONF_PARTIAL_WINDOW):
+        return config
+    model = config[CONF_MODEL]
+    if MODELS[model][0] != "a" or model in PARTIAL_WINDOW_UNSUPPORTED_MODELS:
+        partial_models = [
+            key
+            for key, val in sorted(MODELS.items())
+            if val[0] == "a" and key not in PARTIAL_WINDOW_UNSUPPORTED_MODELS
+        ]
+        raise cv.Invalid(
+            f"The '{CONF_PARTIAL_WINDOW}' option is only available for models "
+            + ", ".join(partial_models)
+        )
+    return config
+
+
 def validate_reset_pin_required(config):
     if config[CONF_MODEL] in RESET_PIN_REQUIRED_MODELS and CONF_RESET_PIN not in config:
         raise cv.Invalid(
@@ -203,6 +223,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_RESET_PIN): pins.gpio_output_pin_schema,
             cv.Optional(CONF_BUSY_PIN): pins.gpio_input_pin_schema,
             cv.Optional(CONF_FULL_UPDATE_EVERY): cv.int_range(min=1, max=4294967295),
+            cv.Optional(CONF_PARTIAL_WINDOW): cv.boolean,
             cv.Optional(CONF_RESET_DURATION): cv.All(
                 cv.positive_time_period_milliseconds,
                 cv.Range(max=core.TimePeriod(milliseconds=500)),
@@ -212,6 +233,7 @@ CONFIG_SCHEMA = cv.All(
     .extend(cv.polling_component_schema("1s"))
     .extend(spi.spi_device_schema()),
     validate_full_update_every_only_types_ac,
+    validate_partial_window,
     validate_reset_pin_required,
     cv.has_at_most_one_key(CONF_PAGES, CONF_LAMBDA),
 )
@@ -251,5 +273,7 @@ async def to_code(config):
         cg.add(var.set_busy_pin(reset))
     if CONF_FULL_UPDATE_EVERY in config:
         cg.add(var.set_full_update_every(config[CONF_FULL_UPDATE_EVERY]))
+    if config.get(CONF_PARTIAL_WINDOW):
+        cg.add(var.set_partial_window(True))
     if CONF_RESET_DURATION in config:
         cg.add(var.set_reset_duration(config[CONF_RESET_DURATION]))
@@ -272,6 +272,69 @@ void HOT WaveshareEPaper::draw_absolute_pixel_internal(int x, int y, Color color
   }
 }
 
+// set or clear count bits starting at bit position start (MSB first) of a 1 bit per pixel buffer
+static void HOT fill_bits(uint8_t *buffer, uint32_t start, uint32_t count, bool set) {
+  const uint8_t fill = set ? 0xFF : 0x00;
+  uint8_t *ptr = buffer + start / 8u;
+  const uint8_t subpos = start & 0x07;
+  if (subpos != 0) {
+    uint8_t mask = 0xFF >> subpos;
+    if (count < 8u - subpos)
+      mask &= ~(0xFF >> (subpos + count));
+    *ptr = (*ptr & ~mask) | (fill & mask);
+    ptr++;
+    count -= std::min<uint32_t>(count, 8u - subpos);
+  }
+  memset(ptr, fill, count / 8u);
+  ptr += count / 8u;
+  if ((count & 0x07) != 0) {
+    const uint8_t mask = ~(0xFF >> (count & 0x07));
+    *ptr = (*ptr & ~mask) | (fill & mask);
+  }
+}
+
+void HOT WaveshareEPaper::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  for (int j = y; j != y + height; j++) {
+    // flip logic
+    fill_bits(this->buffer_, x + j * this->get_width_controller(), width, !color.is_on());
+  }
+}
+
+bool HOT WaveshareEPaper::find_changed_windows_() {
+  this->changed_windows_.clear();
+  if (this->previous_buffer_ == nullptr)
+    return false;
+  const int width_bytes = this->get_width_controller() / 8;
+  for (int y = 0; y != this->get_height_internal(); y++) {
+    const uint8_t *row = this->buffer_ + y * width_bytes;
+    const uint8_t *previous = this->previous_buffer_ + y * width_bytes;
+    if (memcmp(row, previous, width_bytes) == 0)
+      continue;
+    int low = 0;
+    while (row[low] == previous[low])
+      low++;
+    int high = width_bytes - 1;
+    while (row[high] == previous[high])
+      high--;
+    this->changed_windows_.add(low * 8, y, (high - low + 1) * 8, 1);
+  }
+  return true;
+}
+void WaveshareEPaper::store_previous_buffer_() {
+  if (!this->partial_window_)
+    return;
+  if (this->previous_buffer_ == nullptr) {
+    ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+    this->previous_buffer_ = allocator.allocate(this->get_buffer_length_());
+    if (this->previous_buffer_ == nullptr) {
+      ESP_LOGW(TAG, "Could not allocate buffer for partial windows, sending the whole buffer instead");
+      this->partial_window_ = false;
+      return;
+    }
+  }
+  memcpy(this->previous_buffer_, this->buffer_, this->get_buffer_length_());
+}
+
 uint32_t WaveshareEPaper::get_buffer_length_() {
   return this->get_width_controller() * this->get_height_internal() / 8u;
 }  // just a black buffer
@@ -307,6 +370,16 @@ void HOT WaveshareEPaperBWR::draw_absolute_pixel_internal(int x, int y, Color co
     this->buffer_[pos + buf_half_len] &= ~(0x80 >> subpos);
   }
 }
+void HOT WaveshareEPaperBWR::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  const uint32_t buf_half_len = this->get_buffer_length_() / 2u;
+  // draw red pixels only, if the color contains red only
+  const bool red = (color.red > 0) && (color.green == 0) && (color.blue == 0);
+  for (int j = y; j != y + height; j++) {
+    const uint32_t start = x + j * this->get_width_internal();
+    fill_bits(this->buffer_, start, width, color.is_on());
+    fill_bits(this->buffer_ + buf_half_len, start, width, red);
+  }
+}
 void HOT WaveshareEPaper7C::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (x >= this->get_width_internal() || y >= this->get_height_internal() || x < 0 || y < 0)
     return;
@@ -361,6 +434,11 @@ void WaveshareEPaperTypeA::initialize() {
       case WAVESHARE_EPAPER_1_54_IN:
       case WAVESHARE_EPAPER_1_54_IN_V2:
         this->deep_sleep_between_updates_ = true;
+        // the controller loses its RAM in deep sleep, so every update has to send the whole buffer anyway
+        if (this->partial_window_) {
+          ESP_LOGW(TAG, "Partial windows are not used with deep sleep between updates");
+          this->partial_window_ = false;
+        }
         ESP_LOGI(TAG, "Set the display to deep sleep");
         this->deep_sleep();
         break;
@@ -460,6 +538,7 @@ void WaveshareEPaperTypeA::dump_config() {
       break;
   }
   ESP_LOGCONFIG(TAG, "  Full Update Every: %" PRIu32, this->full_update_every_);
+  ESP_LOGCONFIG(TAG, "  Partial Window: %s", YESNO(this->partial_window_));
   LOG_PIN("  Reset Pin: ", this->reset_pin_);
   LOG_PIN("  DC Pin: ", this->dc_pin_);
   LOG_PIN("  Busy Pin: ", this->busy_pin_);
@@ -469,6 +548,18 @@ void HOT WaveshareEPaperTypeA::display() {
   bool full_update = this->at_update_ == 0;
   bool prev_full_update = this->at_update_ == 1;
 
+  // The controller RAM keeps the last frame between partial updates, so only the changed windows need to be sent.
+  // Anything else, including the first update, falls back to sending the whole buffer. Models that deep sleep between
+  // updates lose the RAM and have partial windows turned off in initialize().
+  const bool send_windows =
+      this->partial_window_ && !full_update && this->supports_partial_window_() && this->find_changed_windows_();
+  if (send_windows && this->changed_windows_.empty()) {
+    // Skipped updates do not advance at_update_, so full_update_every counts the refreshes that were actually made.
+    // Only those add ghosting, and the LUT switch below relies on at_update_ == 1 following a full update.
+    ESP_LOGV(TAG, "Nothing changed, skipping update");
+    return;
+  }
+
   if (this->deep_sleep_between_updates_) {
     ESP_LOGI(TAG, "Wake up the display");
     this->reset_();
@@ -540,73 +631,83 @@ void HOT WaveshareEPaperTypeA::display() {
       break;
   }
 
-  // Set x & y regions we want to write to (full)
-  switch (this->model_) {
-    case TTGO_EPAPER_2_13_IN_B1:
-      // COMMAND SET RAM X ADDRESS START END POSITION
-      this->command(0x44);
-      this->data(0x00);
-      this->data((this->get_width_controller() - 1) >> 3);
-      // COMMAND SET RAM Y ADDRESS START END POSITION
-      this->command(0x45);
-      this->data(this->get_height_internal() - 1);
-      this->data((this->get_height_internal() - 1) >> 8);
-      this->data(0x00);
-      this->data(0x00);
-
-      // COMMAND SET RAM X ADDRESS COUNTER
-      this->command(0x4E);
-      this->data(0x00);
-      // COMMAND SET RAM Y ADDRESS COUNTER
-      this->command(0x4F);
-      this->data(this->get_height_internal() - 1);
-      this->data((this->get_height_internal() - 1) >> 8);
-
-      break;
-    default:
-      // COMMAND SET RAM X ADDRESS START END POSITION
-      this->command(0x44);
-      this->data(0x00);
-      this->data((this->get_width_internal() - 1) >> 3);
-      // COMMAND SET RAM Y ADDRESS START END POSITION
-      this->command(0x45);
-      this->data(0x00);
-      this->data(0x00);
-      this->data(this->get_height_internal() - 1);
-      this->data((this->get_height_internal() - 1) >> 8);
+  if (send_windows) {
+    for (const auto &window : this->changed_windows_) {
+      if (!this->write_window_(window)) {
+        this->status_set_warning();
+        return;
+      }
+    }
+  } else {
+    // Set x & y regions we want to write to (full)
+    switch (this->model_) {
+      case TTGO_EPAPER_2_13_IN_B1:
+        // COMMAND SET RAM X ADDRESS START END POSITION
+        this->command(0x44);
+        this->data(0x00);
+        this->data((this->get_width_controller() - 1) >> 3);
+        // COMMAND SET RAM Y ADDRESS START END POSITION
+        this->command(0x45);
+        this->data(this->get_height_internal() - 1);
+        this->data((this->get_height_internal() - 1) >> 8);
+        this->data(0x00);
+        this->data(0x00);
+
+        // COMMAND SET RAM X ADDRESS COUNTER
+        this->command(0x4E);
+        this->data(0x00);
+        // COMMAND SET RAM Y ADDRESS COUNTER
+        this->command(0x4F);
+        this->data(this->get_height_internal() - 1);
+        this->data((this->get_height_internal() - 1) >> 8);
 
-      // COMMAND SET RAM X ADDRESS COUNTER
-      this->command(0x4E);
-      this->data(0x00);
-      // COMMAND SET RAM Y ADDRESS COUNTER
-      this->command(0x4F);
-      this->data(0x00);
-      this->data(0x00);
-  }
+        break;
+      default:
+        // COMMAND SET RAM X ADDRESS START END POSITION
+        this->command(0x44);
+        this->data(0x00);
+        this->data((this->get_width_internal() - 1) >> 3);
+        // COMMAND SET RAM Y ADDRESS START END POSITION
+        this->command(0x45);
+        this->data(0x00);
+        this->data(0x00);
+        this->data(this->get_height_internal() - 1);
+        this->data((this->get_height_internal() - 1) >> 8);
+
+        // COMMAND SET RAM X ADDRESS COUNTER
+        this->command(0x4E);
+        this->data(0x00);
+        // COMMAND SET RAM Y ADDRESS COUNTER
+        this->command(0x4F);
+        this->data(0x00);
+        this->data(0x00);
+    }
 
-  if (!this->wait_until_idle_()) {
-    this->status_set_warning();
-    return;
-  }
+    if (!this->wait_until_idle_()) {
+      this->status_set_warning();
+      return;
+    }
 
-  // COMMAND WRITE RAM
-  this->command(0x24);
-  this->start_data_();
-  switch (this->model_) {
-    case TTGO_EPAPER_2_13_IN_B1: {  // block needed because of variable initializations
-      int16_t wb = ((this->get_width_controller()) >> 3);
-      for (int i = 0; i < this->get_height_internal(); i++) {
-        for (int j = 0; j < wb; j++) {
-          int idx = j + (this->get_height_internal() - 1 - i) * wb;
-          this->write_byte(this->buffer_[idx]);
+    // COMMAND WRITE RAM
+    this->command(0x24);
+    this->start_data_();
+    switch (this->model_) {
+      case TTGO_EPAPER_2_13_IN_B1: {  // block needed because of variable initializations
+        int16_t wb = ((this->get_width_controller()) >> 3);
+        for (int i = 0; i < this->get_height_internal(); i++) {
+          for (int j = 0; j < wb; j++) {
+            int idx = j + (this->get_height_internal() - 1 - i) * wb;
+            this->write_byte(this->buffer_[idx]);
+          }
         }
+        break;
       }
-      break;
+      default:
+        this->write_array(this->buffer_, this->get_buffer_length_());
     }
-    default:
-      this->write_array(this->buffer_, this->get_buffer_length_());
+    this->end_data_();
   }
-  this->end_data_();
+  this->store_previous_buffer_();
 
   if (this->model_ == WAVESHARE_EPAPER_2_13_IN_V2 && full_update) {
     // Write base image again on full refresh
@@ -647,6 +748,49 @@ void HOT WaveshareEPaperTypeA::display() {
     this->deep_sleep();
   }
 }
+bool WaveshareEPaperTypeA::supports_partial_window_() const {
+  switch (this->model_) {
+    case TTGO_EPAPER_2_13_IN_B1:       // the RAM is written bottom up
+    case WAVESHARE_EPAPER_2_13_IN_V2:  // partial updates swap between two RAM buffers
+      return false;
+    default:
+      return true;
+  }
+}
+bool HOT WaveshareEPaperTypeA::write_window_(const display::Rect &window) {
+  const int width_bytes = this->get_width_controller() / 8;
+  const int x_start = window.x / 8;
+  const int x_end = window.x2() / 8 - 1;
+  const int y_end = window.y2() - 1;
+  // COMMAND SET RAM X ADDRESS START END POSITION
+  this->command(0x44);
+  this->data(x_start);
+  this->data(x_end);
+  // COMMAND SET RAM Y ADDRESS START END POSITION
+  this->command(0x45);
+  this->data(window.y);
+  this->data(window.y >> 8);
+  this->data(y_end);
+  this->data(y_end >> 8);
+  // COMMAND SET RAM X ADDRESS COUNTER
+  this->command(0x4E);
+  this->data(x_start);
+  // COMMAND SET RAM Y ADDRESS COUNTER
+  this->command(0x4F);
+  this->data(window.y);
+  this->data(window.y >> 8);
+
+  if (!this->wait_until_idle_())
+    return false;
+
+  // COMMAND WRITE RAM
+  this->command(0x24);
+  this->start_data_();
+  for (int y = window.y; y != window.y2(); y++)
+    this->write_array(this->buffer_ + y * width_bytes + x_start, x_end - x_start + 1);
+  this->end_data_();
+  return true;
+}
 int WaveshareEPaperTypeA::get_width_internal() {
   switch (this->model_) {
     case WAVESHARE_EPAPER_1_54_IN:
@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/components/spi/spi.h"
 #include "esphome/components/display/display_buffer.h"
+#include "esphome/components/display/dirty_regions.h"
 
 namespace esphome {
 namespace waveshare_epaper {
@@ -67,9 +68,28 @@ class WaveshareEPaper : public WaveshareEPaperBase {
 
   display::DisplayType get_display_type() override { return display::DisplayType::DISPLAY_TYPE_BINARY; }
 
+  /** Send only the windows of the buffer that changed since the last update on partial refreshes.
+   * Updates without any change are skipped and do not count towards full_update_every. Ignored by models that deep
+   * sleep between updates.
+   */
+  void set_partial_window(bool partial_window) { this->partial_window_ = partial_window; }
+
  protected:
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x, int y, int width, int height, Color color) override;
   uint32_t get_buffer_length_() override;
+
+  /** Collect the areas of the buffer that changed since the last store_previous_buffer_() in changed_windows_,
+   * aligned to whole bytes of a row. Returns false if there is no previous frame to compare with, in which case the
+   * whole buffer has to be sent.
+   */
+  bool find_changed_windows_();
+  /// Keep a copy of the buffer as it was sent to the controller, if partial windows are enabled.
+  void store_previous_buffer_();
+
+  bool partial_window_{false};
+  uint8_t *previous_buffer_{nullptr};
+  display::DirtyRegions changed_windows_{};
 };
 
 class WaveshareEPaperBWR : public WaveshareEPaperBase {
@@ -80,6 +100,7 @@ class WaveshareEPaperBWR : public WaveshareEPaperBase {
 
  protected:
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x, int y, int width, int height, Color color) override;
   uint32_t get_buffer_length_() override;
 };
 
@@ -154,6 +175,11 @@ class WaveshareEPaperTypeA : public WaveshareEPaper {
 
   void init_display_();
 
+  /// Whether the controller keeps its RAM between partial updates and can be written in windows.
+  bool supports_partial_window_() const;
+  /// Write the part of the buffer within window, which is aligned to whole bytes, to the controller RAM.
+  bool write_window_(const display::Rect &window);
+
   int get_width_internal() override;
 
   int get_height_internal() override;
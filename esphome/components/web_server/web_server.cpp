@@ -72,6 +72,15 @@ UrlMatch match_url(const std::string &url, bool only_domain = false) {
   return match;
 }
 
+const std::string &StateMessageCache::get(WebServer *ws, void *source, message_generator_t *message_generator) {
+  if (source != this->source_ || message_generator != this->message_generator_) {
+    this->message_ = message_generator(ws, source);
+    this->source_ = source;
+    this->message_generator_ = message_generator;
+  }
+  return this->message_;
+}
+
 #ifdef USE_ARDUINO
 // helper for allowing only unique entries in the queue
 void DeferredUpdateEventSource::deq_push_back_with_dedup_(void *source, message_generator_t *message_generator) {
@@ -87,10 +96,10 @@ void DeferredUpdateEventSource::deq_push_back_with_dedup_(void *source, message_
   }
 }
 
-void DeferredUpdateEventSource::process_deferred_queue_() {
+void DeferredUpdateEventSource::process_deferred_queue_(StateMessageCache &messages) {
   while (!deferred_queue_.empty()) {
     DeferredEvent &de = deferred_queue_.front();
-    std::string message = de.message_generator_(web_server_, de.source_);
+    const std::string &message = messages.get(web_server_, de.source_, de.message_generator_);
     if (this->try_send(message.c_str(), "state")) {
       // O(n) but memory efficiency is more important than speed here which is why std::vector was chosen
       deferred_queue_.erase(deferred_queue_.begin());
@@ -100,14 +109,21 @@ void DeferredUpdateEventSource::process_deferred_queue_() {
   }
 }
 
-void DeferredUpdateEventSource::loop() {
-  process_deferred_queue_();
+void DeferredUpdateEventSource::loop(StateMessageCache &messages) {
+  process_deferred_queue_(messages);
   if (!this->entities_iterator_.completed())
     this->entities_iterator_.advance();
 }
 
 void DeferredUpdateEventSource::deferrable_send_state(void *source, const char *event_type,
                                                       message_generator_t *message_generator) {
+  StateMessageCache messages;
+  this->deferrable_send_state(source, event_type, message_generator, messages);
+}
+
+void DeferredUpdateEventSource::deferrable_send_state(void *source, const char *event_type,
+                                                      message_generator_t *message_generator,
+                                                      StateMessageCache &messages) {
   // allow all json "details_all" to go through before publishing bare state events, this avoids unnamed entries showing
   // up in the web GUI and reduces event load during initial connect
   if (!entities_iterator_.completed() && 0 != strcmp(event_type, "state_detail_all"))
@@ -125,12 +141,12 @@ void DeferredUpdateEventSource::deferrable_send_state(void *source, const char *
   }
 
   if (!deferred_queue_.empty())
-    process_deferred_queue_();
+    process_deferred_queue_(messages);
   if (!deferred_queue_.empty()) {
     // deferred queue still not empty which means downstream event queue full, no point trying to send first
     deq_push_back_with_dedup_(source, message_generator);
   } else {
-    std::string message = message_generator(web_server_, source);
+    const std::string &message = messages.get(web_server_, source, message_generator);
     if (!this->try_send(message.c_str(), "state")) {
       deq_push_back_with_dedup_(source, message_generator);
     }
@@ -144,15 +160,19 @@ void DeferredUpdateEventSource::try_send_nodefer(const char *message, const char
 }
 
 void DeferredUpdateEventSourceList::loop() {
+  // clients draining their deferred queues in the same pass share the last generated message
+  StateMessageCache messages;
   for (DeferredUpdateEventSource *dues : *this) {
-    dues->loop();
+    dues->loop(messages);
   }
 }
 
 void DeferredUpdateEventSourceList::deferrable_send_state(void *source, const char *event_type,
                                                           message_generator_t *message_generator) {
+  // serialize the state once for all clients
+  StateMessageCache messages;
   for (DeferredUpdateEventSource *dues : *this) {
-    dues->deferrable_send_state(source, event_type, message_generator);
+    dues->deferrable_send_state(source, event_type, message_generator, messages);
   }
 }
 
@@ -185,9 +205,9 @@ void DeferredUpdateEventSourceList::on_client_connect_(WebServer *ws, DeferredUp
   source->try_send_nodefer(message.c_str(), "ping", millis(), 30000);
 
   for (auto &group : ws->sorting_groups_) {
-    message = json::build_json([group](JsonObject root) {
-      root["name"] = group.second.name;
-      root["sorting_weight"] = group.second.weight;
+    message = json::write_json([group](json::JsonWriter &root) {
+      root.add("name", group.second.name);
+      root.add("sorting_weight", group.second.weight);
     });
 
     // up to 31 groups should be able to be queued initially without defer
@@ -225,12 +245,12 @@ void WebServer::set_js_include(const char *js_include) { this->js_include_ = js_
 #endif
 
 std::string WebServer::get_config_json() {
-  return json::build_json([this](JsonObject root) {
-    root["title"] = App.get_friendly_name().empty() ? App.get_name() : App.get_friendly_name();
-    root["comment"] = App.get_comment();
-    root["ota"] = this->allow_ota_;
-    root["log"] = this->expose_log_;
-    root["lang"] = "en";
+  return json::write_json([this](json::JsonWriter &root) {
+    root.add("title", App.get_friendly_name().empty() ? App.get_name() : App.get_friendly_name());
+    root.add("comment", App.get_comment());
+    root.add("ota", this->allow_ota_);
+    root.add("log", this->expose_log_);
+    root.add("lang", "en");
   });
 }
 
@@ -332,22 +352,22 @@ void WebServer::handle_js_request(AsyncWebServerRequest *request) {
 #endif
 
 #define set_json_id(root, obj, sensor, start_config) \
-  (root)["id"] = sensor; \
+  (root).add("id", sensor); \
   if (((start_config) == DETAIL_ALL)) { \
-    (root)["name"] = (obj)->get_name(); \
-    (root)["icon"] = (obj)->get_icon(); \
-    (root)["entity_category"] = (obj)->get_entity_category(); \
+    (root).add("name", (obj)->get_name()); \
+    (root).add("icon", (obj)->get_icon()); \
+    (root).add("entity_category", (obj)->get_entity_category()); \
     if ((obj)->is_disabled_by_default()) \
-      (root)["is_disabled_by_default"] = (obj)->is_disabled_by_default(); \
+      (root).add("is_disabled_by_default", (obj)->is_disabled_by_default()); \
   }
 
 #define set_json_value(root, obj, sensor, value, start_config) \
   set_json_id((root), (obj), sensor, start_config); \
-  (root)["value"] = value;
+  (root).add("value", value);
 
 #define set_json_icon_state_value(root, obj, sensor, state, value, start_config) \
   set_json_value(root, obj, sensor, value, start_config); \
-  (root)["state"] = state;
+  (root).add("state", state);
 
 #ifdef USE_SENSOR
 void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
@@ -356,19 +376,20 @@ void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
   this->events_.deferrable_send_state(obj, "state", sensor_state_json_generator);
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (sensor::Sensor *obj : App.get_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->sensor_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
+  sensor::Sensor *obj = App.get_sensor_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->sensor_json(obj, obj->state, detail);
+    request->send(200, "application/json", data.c_str());
+    return;
   }
   request->send(404);
 }
@@ -379,7 +400,7 @@ std::string WebServer::sensor_all_json_generator(WebServer *web_server, void *so
   return web_server->sensor_json((sensor::Sensor *) (source), ((sensor::Sensor *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
+  return json::write_json([this, obj, value, start_config](json::JsonWriter &root) {
     std::string state;
     if (std::isnan(value)) {
       state = "NA";
@@ -391,13 +412,13 @@ std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail
     set_json_icon_state_value(root, obj, "sensor-" + obj->get_object_id(), state, value, start_config);
     if (start_config == DETAIL_ALL) {
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
       if (!obj->get_unit_of_measurement().empty())
-        root["uom"] = obj->get_unit_of_measurement();
+        root.add("uom", obj->get_unit_of_measurement());
     }
   });
 }
@@ -410,19 +431,20 @@ void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::s
   this->events_.deferrable_send_state(obj, "state", text_sensor_state_json_generator);
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (text_sensor::TextSensor *obj : App.get_text_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->text_sensor_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
+  text_sensor::TextSensor *obj = App.get_text_sensor_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->text_sensor_json(obj, obj->state, detail);
+    request->send(200, "application/json", data.c_str());
+    return;
   }
   request->send(404);
 }
@@ -436,13 +458,13 @@ std::string WebServer::text_sensor_all_json_generator(WebServer *web_server, voi
 }
 std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std::string &value,
                                         JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
+  return json::write_json([this, obj, value, start_config](json::JsonWriter &root) {
     set_json_icon_state_value(root, obj, "text_sensor-" + obj->get_object_id(), value, value, start_config);
     if (start_config == DETAIL_ALL) {
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -457,33 +479,31 @@ void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
   this->events_.deferrable_send_state(obj, "state", switch_state_json_generator);
 }
 void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (switch_::Switch *obj : App.get_switches()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->switch_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->schedule_([obj]() { obj->toggle(); });
-      request->send(200);
-    } else if (match.method == "turn_on") {
-      this->schedule_([obj]() { obj->turn_on(); });
-      request->send(200);
-    } else if (match.method == "turn_off") {
-      this->schedule_([obj]() { obj->turn_off(); });
-      request->send(200);
-    } else {
-      request->send(404);
-    }
+  switch_::Switch *obj = App.get_switch_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->switch_json(obj, obj->state, detail);
+    request->send(200, "application/json", data.c_str());
+  } else if (match.method == "toggle") {
+    this->schedule_([obj]() { obj->toggle(); });
+    request->send(200);
+  } else if (match.method == "turn_on") {
+    this->schedule_([obj]() { obj->turn_on(); });
+    request->send(200);
+  } else if (match.method == "turn_off") {
+    this->schedule_([obj]() { obj->turn_off(); });
+    request->send(200);
+  } else {
+    request->send(404);
+  }
 }
 std::string WebServer::switch_state_json_generator(WebServer *web_server, void *source) {
   return web_server->switch_json((switch_::Switch *) (source), ((switch_::Switch *) (source))->state, DETAIL_STATE);
@@ -492,14 +512,14 @@ std::string WebServer::switch_all_json_generator(WebServer *web_server, void *so
   return web_server->switch_json((switch_::Switch *) (source), ((switch_::Switch *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
+  return json::write_json([this, obj, value, start_config](json::JsonWriter &root) {
     set_json_icon_state_value(root, obj, "switch-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
     if (start_config == DETAIL_ALL) {
-      root["assumed_state"] = obj->assumed_state();
+      root.add("assumed_state", obj->assumed_state());
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -509,27 +529,26 @@ std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail
 
 #ifdef USE_BUTTON
 void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (button::Button *obj : App.get_buttons()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->button_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "press") {
-      this->schedule_([obj]() { obj->press(); });
-      request->send(200);
-      return;
-    } else {
-      request->send(404);
-    }
+  button::Button *obj = App.get_button_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->button_json(obj, detail);
+    request->send(200, "application/json", data.c_str());
+  } else if (match.method == "press") {
+    this->schedule_([obj]() { obj->press(); });
+    request->send(200);
+    return;
+  } else {
+    request->send(404);
+  }
 }
 std::string WebServer::button_state_json_generator(WebServer *web_server, void *source) {
   return web_server->button_json((button::Button *) (source), DETAIL_STATE);
@@ -538,13 +557,13 @@ std::string WebServer::button_all_json_generator(WebServer *web_server, void *so
   return web_server->button_json((button::Button *) (source), DETAIL_ALL);
 }
 std::string WebServer::button_json(button::Button *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
+  return json::write_json([this, obj, start_config](json::JsonWriter &root) {
     set_json_id(root, obj, "button-" + obj->get_object_id(), start_config);
     if (start_config == DETAIL_ALL) {
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -559,19 +578,20 @@ void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool s
   this->events_.deferrable_send_state(obj, "state", binary_sensor_state_json_generator);
 }
 void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (binary_sensor::BinarySensor *obj : App.get_binary_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->binary_sensor_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
+  binary_sensor::BinarySensor *obj = App.get_binary_sensor_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->binary_sensor_json(obj, obj->state, detail);
+    request->send(200, "application/json", data.c_str());
+    return;
   }
   request->send(404);
 }
@@ -584,14 +604,14 @@ std::string WebServer::binary_sensor_all_json_generator(WebServer *web_server, v
                                         ((binary_sensor::BinarySensor *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
+  return json::write_json([this, obj, value, start_config](json::JsonWriter &root) {
     set_json_icon_state_value(root, obj, "binary_sensor-" + obj->get_object_id(), value ? "ON" : "OFF", value,
                               start_config);
     if (start_config == DETAIL_ALL) {
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -606,59 +626,57 @@ void WebServer::on_fan_update(fan::Fan *obj) {
   this->events_.deferrable_send_state(obj, "state", fan_state_json_generator);
 }
 void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (fan::Fan *obj : App.get_fans()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->fan_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->schedule_([obj]() { obj->toggle().perform(); });
-      request->send(200);
-    } else if (match.method == "turn_on" || match.method == "turn_off") {
-      auto call = match.method == "turn_on" ? obj->turn_on() : obj->turn_off();
-
-      if (request->hasParam("speed_level")) {
-        auto speed_level = request->getParam("speed_level")->value();
-        auto val = parse_number<int>(speed_level.c_str());
-        if (!val.has_value()) {
-          ESP_LOGW(TAG, "Can't convert '%s' to number!", speed_level.c_str());
+  fan::Fan *obj = App.get_fan_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->fan_json(obj, detail);
+    request->send(200, "application/json", data.c_str());
+  } else if (match.method == "toggle") {
+    this->schedule_([obj]() { obj->toggle().perform(); });
+    request->send(200);
+  } else if (match.method == "turn_on" || match.method == "turn_off") {
+    auto call = match.method == "turn_on" ? obj->turn_on() : obj->turn_off();
+
+    if (request->hasParam("speed_level")) {
+      auto speed_level = request->getParam("speed_level")->value();
+      auto val = parse_number<int>(speed_level.c_str());
+      if (!val.has_value()) {
+        ESP_LOGW(TAG, "Can't convert '%s' to number!", speed_level.c_str());
+        return;
+      }
+      call.set_speed(*val);
+    }
+    if (request->hasParam("oscillation")) {
+      auto speed = request->getParam("oscillation")->value();
+      auto val = parse_on_off(speed.c_str());
+      switch (val) {
+        case PARSE_ON:
+          call.set_oscillating(true);
+          break;
+        case PARSE_OFF:
+          call.set_oscillating(false);
+          break;
+        case PARSE_TOGGLE:
+          call.set_oscillating(!obj->oscillating);
+          break;
+        case PARSE_NONE:
+          request->send(404);
           return;
-        }
-        call.set_speed(*val);
-      }
-      if (request->hasParam("oscillation")) {
-        auto speed = request->getParam("oscillation")->value();
-        auto val = parse_on_off(speed.c_str());
-        switch (val) {
-          case PARSE_ON:
-            call.set_oscillating(true);
-            break;
-          case PARSE_OFF:
-            call.set_oscillating(false);
-            break;
-          case PARSE_TOGGLE:
-            call.set_oscillating(!obj->oscillating);
-            break;
-          case PARSE_NONE:
-            request->send(404);
-            return;
-        }
       }
-      this->schedule_([call]() mutable { call.perform(); });
-      request->send(200);
-    } else {
-      request->send(404);
     }
-    return;
+    this->schedule_([call]() mutable { call.perform(); });
+    request->send(200);
+  } else {
+    request->send(404);
   }
-  request->send(404);
 }
 std::string WebServer::fan_state_json_generator(WebServer *web_server, void *source) {
   return web_server->fan_json((fan::Fan *) (source), DETAIL_STATE);
@@ -667,21 +685,21 @@ std::string WebServer::fan_all_json_generator(WebServer *web_server, void *sourc
   return web_server->fan_json((fan::Fan *) (source), DETAIL_ALL);
 }
 std::string WebServer::fan_json(fan::Fan *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
+  return json::write_json([this, obj, start_config](json::JsonWriter &root) {
     set_json_icon_state_value(root, obj, "fan-" + obj->get_object_id(), obj->state ? "ON" : "OFF", obj->state,
                               start_config);
     const auto traits = obj->get_traits();
     if (traits.supports_speed()) {
-      root["speed_level"] = obj->speed;
-      root["speed_count"] = traits.supported_speed_count();
+      root.add("speed_level", obj->speed);
+      root.add("speed_count", traits.supported_speed_count());
     }
     if (obj->get_traits().supports_oscillation())
-      root["oscillation"] = obj->oscillating;
+      root.add("oscillation", obj->oscillating);
     if (start_config == DETAIL_ALL) {
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -696,94 +714,92 @@ void WebServer::on_light_update(light::LightState *obj) {
   this->events_.deferrable_send_state(obj, "state", light_state_json_generator);
 }
 void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (light::LightState *obj : App.get_lights()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->light_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->schedule_([obj]() { obj->toggle().perform(); });
-      request->send(200);
-    } else if (match.method == "turn_on") {
-      auto call = obj->turn_on();
-      if (request->hasParam("brightness")) {
-        auto brightness = parse_number<float>(request->getParam("brightness")->value().c_str());
-        if (brightness.has_value()) {
-          call.set_brightness(*brightness / 255.0f);
-        }
-      }
-      if (request->hasParam("r")) {
-        auto r = parse_number<float>(request->getParam("r")->value().c_str());
-        if (r.has_value()) {
-          call.set_red(*r / 255.0f);
-        }
+  light::LightState *obj = App.get_light_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->light_json(obj, detail);
+    request->send(200, "application/json", data.c_str());
+  } else if (match.method == "toggle") {
+    this->schedule_([obj]() { obj->toggle().perform(); });
+    request->send(200);
+  } else if (match.method == "turn_on") {
+    auto call = obj->turn_on();
+    if (request->hasParam("brightness")) {
+      auto brightness = parse_number<float>(request->getParam("brightness")->value().c_str());
+      if (brightness.has_value()) {
+        call.set_brightness(*brightness / 255.0f);
       }
-      if (request->hasParam("g")) {
-        auto g = parse_number<float>(request->getParam("g")->value().c_str());
-        if (g.has_value()) {
-          call.set_green(*g / 255.0f);
-        }
+    }
+    if (request->hasParam("r")) {
+      auto r = parse_number<float>(request->getParam("r")->value().c_str());
+      if (r.has_value()) {
+        call.set_red(*r / 255.0f);
       }
-      if (request->hasParam("b")) {
-        auto b = parse_number<float>(request->getParam("b")->value().c_str());
-        if (b.has_value()) {
-          call.set_blue(*b / 255.0f);
-        }
+    }
+    if (request->hasParam("g")) {
+      auto g = parse_number<float>(request->getParam("g")->value().c_str());
+      if (g.has_value()) {
+        call.set_green(*g / 255.0f);
       }
-      if (request->hasParam("white_value")) {
-        auto white_value = parse_number<float>(request->getParam("white_value")->value().c_str());
-        if (white_value.has_value()) {
-          call.set_white(*white_value / 255.0f);
-        }
+    }
+    if (request->hasParam("b")) {
+      auto b = parse_number<float>(request->getParam("b")->value().c_str());
+      if (b.has_value()) {
+        call.set_blue(*b / 255.0f);
       }
-      if (request->hasParam("color_temp")) {
-        auto color_temp = parse_number<float>(request->getParam("color_temp")->value().c_str());
-        if (color_temp.has_value()) {
-          call.set_color_temperature(*color_temp);
-        }
+    }
+    if (request->hasParam("white_value")) {
+      auto white_value = parse_number<float>(request->getParam("white_value")->value().c_str());
+      if (white_value.has_value()) {
+        call.set_white(*white_value / 255.0f);
       }
-      if (request->hasParam("flash")) {
-        auto flash = parse_number<uint32_t>(request->getParam("flash")->value().c_str());
-        if (flash.has_value()) {
-          call.set_flash_length(*flash * 1000);
-        }
+    }
+    if (request->hasParam("color_temp")) {
+      auto color_temp = parse_number<float>(request->getParam("color_temp")->value().c_str());
+      if (color_temp.has_value()) {
+        call.set_color_temperature(*color_temp);
       }
-      if (request->hasParam("transition")) {
-        auto transition = parse_number<uint32_t>(request->getParam("transition")->value().c_str());
-        if (transition.has_value()) {
-          call.set_transition_length(*transition * 1000);
-        }
+    }
+    if (request->hasParam("flash")) {
+      auto flash = parse_number<uint32_t>(request->getParam("flash")->value().c_str());
+      if (flash.has_value()) {
+        call.set_flash_length(*flash * 1000);
       }
-      if (request->hasParam("effect")) {
-        const char *effect = request->getParam("effect")->value().c_str();
-        call.set_effect(effect);
+    }
+    if (request->hasParam("transition")) {
+      auto transition = parse_number<uint32_t>(request->getParam("transition")->value().c_str());
+      if (transition.has_value()) {
+        call.set_transition_length(*transition * 1000);
       }
+    }
+    if (request->hasParam("effect")) {
+      const char *effect = request->getParam("effect")->value().c_str();
+      call.set_effect(effect);
+    }
 
-      this->schedule_([call]() mutable { call.perform(); });
-      request->send(200);
-    } else if (match.method == "turn_off") {
-      auto call = obj->turn_off();
-      if (request->hasParam("transition")) {
-        auto transition = parse_number<uint32_t>(request->getParam("transition")->value().c_str());
-        if (transition.has_value()) {
-          call.set_transition_length(*transition * 1000);
-        }
+    this->schedule_([call]() mutable { call.perform(); });
+    request->send(200);
+  } else if (match.method == "turn_off") {
+    auto call = obj->turn_off();
+    if (request->hasParam("transition")) {
+      auto transition = parse_number<uint32_t>(request->getParam("transition")->value().c_str());
+      if (transition.has_value()) {
+        call.set_transition_length(*transition * 1000);
       }
-      this->schedule_([call]() mutable { call.perform(); });
-      request->send(200);
-    } else {
-      request->send(404);
     }
-    return;
+    this->schedule_([call]() mutable { call.perform(); });
+    request->send(200);
+  } else {
+    request->send(404);
   }
-  request->send(404);
 }
 std::string WebServer::light_state_json_generator(WebServer *web_server, void *source) {
   return web_server->light_json((light::LightState *) (source), DETAIL_STATE);
@@ -792,21 +808,24 @@ std::string WebServer::light_all_json_generator(WebServer *web_server, void *sou
   return web_server->light_json((light::LightState *) (source), DETAIL_ALL);
 }
 std::string WebServer::light_json(light::LightState *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
+  return json::write_json([this, obj, start_config](json::JsonWriter &root) {
     set_json_id(root, obj, "light-" + obj->get_object_id(), start_config);
-    root["state"] = obj->remote_values.is_on() ? "ON" : "OFF";
 
     light::LightJSONSchema::dump_json(*obj, root);
+    // dump_json() already writes the state unless the color mode is unknown
+    if (!(obj->remote_values.get_color_mode() & light::ColorCapability::ON_OFF))
+      root.add("state", obj->remote_values.is_on() ? "ON" : "OFF");
     if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("effects");
-      opt.add("None");
+      root.begin_array("effects");
+      root.add("None");
       for (auto const &option : obj->get_effects()) {
-        opt.add(option->get_name());
+        root.add(option->get_name());
       }
+      root.end_array();
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -821,60 +840,58 @@ void WebServer::on_cover_update(cover::Cover *obj) {
   this->events_.deferrable_send_state(obj, "state", cover_state_json_generator);
 }
 void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (cover::Cover *obj : App.get_covers()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->cover_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-
-    auto call = obj->make_call();
-    if (match.method == "open") {
-      call.set_command_open();
-    } else if (match.method == "close") {
-      call.set_command_close();
-    } else if (match.method == "stop") {
-      call.set_command_stop();
-    } else if (match.method == "toggle") {
-      call.set_command_toggle();
-    } else if (match.method != "set") {
-      request->send(404);
-      return;
-    }
-
-    auto traits = obj->get_traits();
-    if ((request->hasParam("position") && !traits.get_supports_position()) ||
-        (request->hasParam("tilt") && !traits.get_supports_tilt())) {
-      request->send(409);
-      return;
-    }
-
-    if (request->hasParam("position")) {
-      auto position = parse_number<float>(request->getParam("position")->value().c_str());
-      if (position.has_value()) {
-        call.set_position(*position);
-      }
-    }
-    if (request->hasParam("tilt")) {
-      auto tilt = parse_number<float>(request->getParam("tilt")->value().c_str());
-      if (tilt.has_value()) {
-        call.set_tilt(*tilt);
-      }
-    }
+  cover::Cover *obj = App.get_cover_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->cover_json(obj, detail);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
 
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
+  auto call = obj->make_call();
+  if (match.method == "open") {
+    call.set_command_open();
+  } else if (match.method == "close") {
+    call.set_command_close();
+  } else if (match.method == "stop") {
+    call.set_command_stop();
+  } else if (match.method == "toggle") {
+    call.set_command_toggle();
+  } else if (match.method != "set") {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  auto traits = obj->get_traits();
+  if ((request->hasParam("position") && !traits.get_supports_position()) ||
+      (request->hasParam("tilt") && !traits.get_supports_tilt())) {
+    request->send(409);
+    return;
+  }
+
+  if (request->hasParam("position")) {
+    auto position = parse_number<float>(request->getParam("position")->value().c_str());
+    if (position.has_value()) {
+      call.set_position(*position);
+    }
+  }
+  if (request->hasParam("tilt")) {
+    auto tilt = parse_number<float>(request->getParam("tilt")->value().c_str());
+    if (tilt.has_value()) {
+      call.set_tilt(*tilt);
+    }
+  }
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
 std::string WebServer::cover_state_json_generator(WebServer *web_server, void *source) {
   return web_server->cover_json((cover::Cover *) (source), DETAIL_STATE);
@@ -883,20 +900,20 @@ std::string WebServer::cover_all_json_generator(WebServer *web_server, void *sou
   return web_server->cover_json((cover::Cover *) (source), DETAIL_STATE);
 }
 std::string WebServer::cover_json(cover::Cover *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
+  return json::write_json([this, obj, start_config](json::JsonWriter &root) {
     set_json_icon_state_value(root, obj, "cover-" + obj->get_object_id(), obj->is_fully_closed() ? "CLOSED" : "OPEN",
                               obj->position, start_config);
-    root["current_operation"] = cover::cover_operation_to_str(obj->current_operation);
+    root.add("current_operation", cover::cover_operation_to_str(obj->current_operation));
 
     if (obj->get_traits().get_supports_position())
-      root["position"] = obj->position;
+      root.add("position", obj->position);
     if (obj->get_traits().get_supports_tilt())
-      root["tilt"] = obj->tilt;
+      root.add("tilt", obj->tilt);
     if (start_config == DETAIL_ALL) {
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -911,37 +928,35 @@ void WebServer::on_number_update(number::Number *obj, float state) {
   this->events_.deferrable_send_state(obj, "state", number_state_json_generator);
 }
 void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_numbers()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->number_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
-
-    auto call = obj->make_call();
-    if (request->hasParam("value")) {
-      auto value = parse_number<float>(request->getParam("value")->value().c_str());
-      if (value.has_value())
-        call.set_value(*value);
-    }
-
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
+  auto *obj = App.get_number_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->number_json(obj, obj->state, detail);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
+
+  auto call = obj->make_call();
+  if (request->hasParam("value")) {
+    auto value = parse_number<float>(request->getParam("value")->value().c_str());
+    if (value.has_value())
+      call.set_value(*value);
+  }
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
 
 std::string WebServer::number_state_json_generator(WebServer *web_server, void *source) {
@@ -951,34 +966,32 @@ std::string WebServer::number_all_json_generator(WebServer *web_server, void *so
   return web_server->number_json((number::Number *) (source), ((number::Number *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::number_json(number::Number *obj, float value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
+  return json::write_json([this, obj, value, start_config](json::JsonWriter &root) {
     set_json_id(root, obj, "number-" + obj->get_object_id(), start_config);
     if (start_config == DETAIL_ALL) {
-      root["min_value"] =
-          value_accuracy_to_string(obj->traits.get_min_value(), step_to_accuracy_decimals(obj->traits.get_step()));
-      root["max_value"] =
-          value_accuracy_to_string(obj->traits.get_max_value(), step_to_accuracy_decimals(obj->traits.get_step()));
-      root["step"] =
-          value_accuracy_to_string(obj->traits.get_step(), step_to_accuracy_decimals(obj->traits.get_step()));
-      root["mode"] = (int) obj->traits.get_mode();
+      int8_t accuracy = step_to_accuracy_decimals(obj->traits.get_step());
+      root.add("min_value", value_accuracy_to_string(obj->traits.get_min_value(), accuracy));
+      root.add("max_value", value_accuracy_to_string(obj->traits.get_max_value(), accuracy));
+      root.add("step", value_accuracy_to_string(obj->traits.get_step(), accuracy));
+      root.add("mode", (int) obj->traits.get_mode());
       if (!obj->traits.get_unit_of_measurement().empty())
-        root["uom"] = obj->traits.get_unit_of_measurement();
+        root.add("uom", obj->traits.get_unit_of_measurement());
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
     if (std::isnan(value)) {
-      root["value"] = "\"NaN\"";
-      root["state"] = "NA";
+      root.add("value", "\"NaN\"");
+      root.add("state", "NA");
     } else {
-      root["value"] = value_accuracy_to_string(value, step_to_accuracy_decimals(obj->traits.get_step()));
+      root.add("value", value_accuracy_to_string(value, step_to_accuracy_decimals(obj->traits.get_step())));
       std::string state = value_accuracy_to_string(value, step_to_accuracy_decimals(obj->traits.get_step()));
       if (!obj->traits.get_unit_of_measurement().empty())
         state += " " + obj->traits.get_unit_of_measurement();
-      root["state"] = state;
+      root.add("state", state);
     }
   });
 }
@@ -991,41 +1004,40 @@ void WebServer::on_date_update(datetime::DateEntity *obj) {
   this->events_.deferrable_send_state(obj, "state", date_state_json_generator);
 }
 void WebServer::handle_date_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_dates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->date_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
-
-    auto call = obj->make_call();
-
-    if (!request->hasParam("value")) {
-      request->send(409);
-      return;
-    }
+  auto *obj = App.get_date_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->date_json(obj, detail);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
 
-    if (request->hasParam("value")) {
-      std::string value = request->getParam("value")->value().c_str();  // NOLINT
-      call.set_date(value);
-    }
+  auto call = obj->make_call();
 
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
+  if (!request->hasParam("value")) {
+    request->send(409);
     return;
   }
-  request->send(404);
+
+  if (request->hasParam("value")) {
+    std::string value = request->getParam("value")->value().c_str();  // NOLINT
+    call.set_date(value);
+  }
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
 
 std::string WebServer::date_state_json_generator(WebServer *web_server, void *source) {
@@ -1035,16 +1047,16 @@ std::string WebServer::date_all_json_generator(WebServer *web_server, void *sour
   return web_server->date_json((datetime::DateEntity *) (source), DETAIL_ALL);
 }
 std::string WebServer::date_json(datetime::DateEntity *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
+  return json::write_json([this, obj, start_config](json::JsonWriter &root) {
     set_json_id(root, obj, "date-" + obj->get_object_id(), start_config);
     std::string value = str_sprintf("%d-%02d-%02d", obj->year, obj->month, obj->day);
-    root["value"] = value;
-    root["state"] = value;
+    root.add("value", value);
+    root.add("state", value);
     if (start_config == DETAIL_ALL) {
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -1059,41 +1071,40 @@ void WebServer::on_time_update(datetime::TimeEntity *obj) {
   this->events_.deferrable_send_state(obj, "state", time_state_json_generator);
 }
 void WebServer::handle_time_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_times()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->time_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
-
-    auto call = obj->make_call();
-
-    if (!request->hasParam("value")) {
-      request->send(409);
-      return;
-    }
+  auto *obj = App.get_time_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->time_json(obj, detail);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
 
-    if (request->hasParam("value")) {
-      std::string value = request->getParam("value")->value().c_str();  // NOLINT
-      call.set_time(value);
-    }
+  auto call = obj->make_call();
 
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
+  if (!request->hasParam("value")) {
+    request->send(409);
     return;
   }
-  request->send(404);
+
+  if (request->hasParam("value")) {
+    std::string value = request->getParam("value")->value().c_str();  // NOLINT
+    call.set_time(value);
+  }
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
 std::string WebServer::time_state_json_generator(WebServer *web_server, void *source) {
   return web_server->time_json((datetime::TimeEntity *) (source), DETAIL_STATE);
@@ -1102,16 +1113,16 @@ std::string WebServer::time_all_json_generator(WebServer *web_server, void *sour
   return web_server->time_json((datetime::TimeEntity *) (source), DETAIL_ALL);
 }
 std::string WebServer::time_json(datetime::TimeEntity *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
+  return json::write_json([this, obj, start_config](json::JsonWriter &root) {
     set_json_id(root, obj, "time-" + obj->get_object_id(), start_config);
     std::string value = str_sprintf("%02d:%02d:%02d", obj->hour, obj->minute, obj->second);
-    root["value"] = value;
-    root["state"] = value;
+    root.add("value", value);
+    root.add("state", value);
     if (start_config == DETAIL_ALL) {
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -1126,41 +1137,40 @@ void WebServer::on_datetime_update(datetime::DateTimeEntity *obj) {
   this->events_.deferrable_send_state(obj, "state", datetime_state_json_generator);
 }
 void WebServer::handle_datetime_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_datetimes()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->datetime_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
-
-    auto call = obj->make_call();
-
-    if (!request->hasParam("value")) {
-      request->send(409);
-      return;
-    }
+  auto *obj = App.get_datetime_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->datetime_json(obj, detail);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
 
-    if (request->hasParam("value")) {
-      std::string value = request->getParam("value")->value().c_str();  // NOLINT
-      call.set_datetime(value);
-    }
+  auto call = obj->make_call();
 
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
+  if (!request->hasParam("value")) {
+    request->send(409);
     return;
   }
-  request->send(404);
+
+  if (request->hasParam("value")) {
+    std::string value = request->getParam("value")->value().c_str();  // NOLINT
+    call.set_datetime(value);
+  }
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
 std::string WebServer::datetime_state_json_generator(WebServer *web_server, void *source) {
   return web_server->datetime_json((datetime::DateTimeEntity *) (source), DETAIL_STATE);
@@ -1169,17 +1179,17 @@ std::string WebServer::datetime_all_json_generator(WebServer *web_server, void *
   return web_server->datetime_json((datetime::DateTimeEntity *) (source), DETAIL_ALL);
 }
 std::string WebServer::datetime_json(datetime::DateTimeEntity *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
+  return json::write_json([this, obj, start_config](json::JsonWriter &root) {
     set_json_id(root, obj, "datetime-" + obj->get_object_id(), start_config);
     std::string value = str_sprintf("%d-%02d-%02d %02d:%02d:%02d", obj->year, obj->month, obj->day, obj->hour,
                                     obj->minute, obj->second);
-    root["value"] = value;
-    root["state"] = value;
+    root.add("value", value);
+    root.add("state", value);
     if (start_config == DETAIL_ALL) {
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -1194,36 +1204,34 @@ void WebServer::on_text_update(text::Text *obj, const std::string &state) {
   this->events_.deferrable_send_state(obj, "state", text_state_json_generator);
 }
 void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_texts()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->text_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
-
-    auto call = obj->make_call();
-    if (request->hasParam("value")) {
-      String value = request->getParam("value")->value();
-      call.set_value(value.c_str());  // NOLINT
-    }
-
-    this->defer([call]() mutable { call.perform(); });
-    request->send(200);
+  auto *obj = App.get_text_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->text_json(obj, obj->state, detail);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
+
+  auto call = obj->make_call();
+  if (request->hasParam("value")) {
+    String value = request->getParam("value")->value();
+    call.set_value(value.c_str());  // NOLINT
+  }
+
+  this->defer([call]() mutable { call.perform(); });
+  request->send(200);
 }
 
 std::string WebServer::text_state_json_generator(WebServer *web_server, void *source) {
@@ -1233,23 +1241,23 @@ std::string WebServer::text_all_json_generator(WebServer *web_server, void *sour
   return web_server->text_json((text::Text *) (source), ((text::Text *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::text_json(text::Text *obj, const std::string &value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
+  return json::write_json([this, obj, value, start_config](json::JsonWriter &root) {
     set_json_id(root, obj, "text-" + obj->get_object_id(), start_config);
-    root["min_length"] = obj->traits.get_min_length();
-    root["max_length"] = obj->traits.get_max_length();
-    root["pattern"] = obj->traits.get_pattern();
+    root.add("min_length", obj->traits.get_min_length());
+    root.add("max_length", obj->traits.get_max_length());
+    root.add("pattern", obj->traits.get_pattern());
     if (obj->traits.get_mode() == text::TextMode::TEXT_MODE_PASSWORD) {
-      root["state"] = "********";
+      root.add("state", "********");
     } else {
-      root["state"] = value;
+      root.add("state", value);
     }
-    root["value"] = value;
+    root.add("value", value);
     if (start_config == DETAIL_ALL) {
-      root["mode"] = (int) obj->traits.get_mode();
+      root.add("mode", (int) obj->traits.get_mode());
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -1264,38 +1272,36 @@ void WebServer::on_select_update(select::Select *obj, const std::string &state,
   this->events_.deferrable_send_state(obj, "state", select_state_json_generator);
 }
 void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_selects()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->select_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
+  auto *obj = App.get_select_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->select_json(obj, obj->state, detail);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
 
-    auto call = obj->make_call();
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
 
-    if (request->hasParam("option")) {
-      auto option = request->getParam("option")->value();
-      call.set_option(option.c_str());  // NOLINT
-    }
+  auto call = obj->make_call();
 
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
-    return;
+  if (request->hasParam("option")) {
+    auto option = request->getParam("option")->value();
+    call.set_option(option.c_str());  // NOLINT
   }
-  request->send(404);
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
 std::string WebServer::select_state_json_generator(WebServer *web_server, void *source) {
   return web_server->select_json((select::Select *) (source), ((select::Select *) (source))->state, DETAIL_STATE);
@@ -1304,17 +1310,18 @@ std::string WebServer::select_all_json_generator(WebServer *web_server, void *so
   return web_server->select_json((select::Select *) (source), ((select::Select *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::select_json(select::Select *obj, const std::string &value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
+  return json::write_json([this, obj, value, start_config](json::JsonWriter &root) {
     set_json_icon_state_value(root, obj, "select-" + obj->get_object_id(), value, value, start_config);
     if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("option");
+      root.begin_array("option");
       for (auto &option : obj->traits.get_options()) {
-        opt.add(option);
+        root.add(option);
       }
+      root.end_array();
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -1332,66 +1339,64 @@ void WebServer::on_climate_update(climate::Climate *obj) {
   this->events_.deferrable_send_state(obj, "state", climate_state_json_generator);
 }
 void WebServer::handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_climates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->climate_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
+  auto *obj = App.get_climate_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->climate_json(obj, detail);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
 
-    auto call = obj->make_call();
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
 
-    if (request->hasParam("mode")) {
-      auto mode = request->getParam("mode")->value();
-      call.set_mode(mode.c_str());  // NOLINT
-    }
+  auto call = obj->make_call();
 
-    if (request->hasParam("fan_mode")) {
-      auto mode = request->getParam("fan_mode")->value();
-      call.set_fan_mode(mode.c_str());  // NOLINT
-    }
+  if (request->hasParam("mode")) {
+    auto mode = request->getParam("mode")->value();
+    call.set_mode(mode.c_str());  // NOLINT
+  }
 
-    if (request->hasParam("swing_mode")) {
-      auto mode = request->getParam("swing_mode")->value();
-      call.set_swing_mode(mode.c_str());  // NOLINT
-    }
+  if (request->hasParam("fan_mode")) {
+    auto mode = request->getParam("fan_mode")->value();
+    call.set_fan_mode(mode.c_str());  // NOLINT
+  }
 
-    if (request->hasParam("target_temperature_high")) {
-      auto target_temperature_high = parse_number<float>(request->getParam("target_temperature_high")->value().c_str());
-      if (target_temperature_high.has_value())
-        call.set_target_temperature_high(*target_temperature_high);
-    }
+  if (request->hasParam("swing_mode")) {
+    auto mode = request->getParam("swing_mode")->value();
+    call.set_swing_mode(mode.c_str());  // NOLINT
+  }
 
-    if (request->hasParam("target_temperature_low")) {
-      auto target_temperature_low = parse_number<float>(request->getParam("target_temperature_low")->value().c_str());
-      if (target_temperature_low.has_value())
-        call.set_target_temperature_low(*target_temperature_low);
-    }
+  if (request->hasParam("target_temperature_high")) {
+    auto target_temperature_high = parse_number<float>(request->getParam("target_temperature_high")->value().c_str());
+    if (target_temperature_high.has_value())
+      call.set_target_temperature_high(*target_temperature_high);
+  }
 
-    if (request->hasParam("target_temperature")) {
-      auto target_temperature = parse_number<float>(request->getParam("target_temperature")->value().c_str());
-      if (target_temperature.has_value())
-        call.set_target_temperature(*target_temperature);
-    }
+  if (request->hasParam("target_temperature_low")) {
+    auto target_temperature_low = parse_number<float>(request->getParam("target_temperature_low")->value().c_str());
+    if (target_temperature_low.has_value())
+      call.set_target_temperature_low(*target_temperature_low);
+  }
 
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
-    return;
+  if (request->hasParam("target_temperature")) {
+    auto target_temperature = parse_number<float>(request->getParam("target_temperature")->value().c_str());
+    if (target_temperature.has_value())
+      call.set_target_temperature(*target_temperature);
   }
-  request->send(404);
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
 std::string WebServer::climate_state_json_generator(WebServer *web_server, void *source) {
   return web_server->climate_json((climate::Climate *) (source), DETAIL_STATE);
@@ -1400,7 +1405,7 @@ std::string WebServer::climate_all_json_generator(WebServer *web_server, void *s
   return web_server->climate_json((climate::Climate *) (source), DETAIL_ALL);
 }
 std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
+  return json::write_json([this, obj, start_config](json::JsonWriter &root) {
     set_json_id(root, obj, "climate-" + obj->get_object_id(), start_config);
     const auto traits = obj->get_traits();
     int8_t target_accuracy = traits.get_target_temperature_accuracy_decimals();
@@ -1408,86 +1413,94 @@ std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_conf
     char buf[16];
 
     if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("modes");
+      root.begin_array("modes");
       for (climate::ClimateMode m : traits.get_supported_modes())
-        opt.add(PSTR_LOCAL(climate::climate_mode_to_string(m)));
+        root.add(PSTR_LOCAL(climate::climate_mode_to_string(m)));
+      root.end_array();
       if (!traits.get_supported_custom_fan_modes().empty()) {
-        JsonArray opt = root.createNestedArray("fan_modes");
+        root.begin_array("fan_modes");
         for (climate::ClimateFanMode m : traits.get_supported_fan_modes())
-          opt.add(PSTR_LOCAL(climate::climate_fan_mode_to_string(m)));
+          root.add(PSTR_LOCAL(climate::climate_fan_mode_to_string(m)));
+        root.end_array();
       }
 
       if (!traits.get_supported_custom_fan_modes().empty()) {
-        JsonArray opt = root.createNestedArray("custom_fan_modes");
+        root.begin_array("custom_fan_modes");
         for (auto const &custom_fan_mode : traits.get_supported_custom_fan_modes())
-          opt.add(custom_fan_mode);
+          root.add(custom_fan_mode);
+        root.end_array();
       }
       if (traits.get_supports_swing_modes()) {
-        JsonArray opt = root.createNestedArray("swing_modes");
+        root.begin_array("swing_modes");
         for (auto swing_mode : traits.get_supported_swing_modes())
-          opt.add(PSTR_LOCAL(climate::climate_swing_mode_to_string(swing_mode)));
+          root.add(PSTR_LOCAL(climate::climate_swing_mode_to_string(swing_mode)));
+        root.end_array();
       }
       if (traits.get_supports_presets() && obj->preset.has_value()) {
-        JsonArray opt = root.createNestedArray("presets");
+        root.begin_array("presets");
         for (climate::ClimatePreset m : traits.get_supported_presets())
-          opt.add(PSTR_LOCAL(climate::climate_preset_to_string(m)));
+          root.add(PSTR_LOCAL(climate::climate_preset_to_string(m)));
+        root.end_array();
       }
       if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
-        JsonArray opt = root.createNestedArray("custom_presets");
+        root.begin_array("custom_presets");
         for (auto const &custom_preset : traits.get_supported_custom_presets())
-          opt.add(custom_preset);
+          root.add(custom_preset);
+        root.end_array();
       }
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
 
     bool has_state = false;
-    root["mode"] = PSTR_LOCAL(climate_mode_to_string(obj->mode));
-    root["max_temp"] = value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy);
-    root["min_temp"] = value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy);
-    root["step"] = traits.get_visual_target_temperature_step();
+    root.add("mode", PSTR_LOCAL(climate_mode_to_string(obj->mode)));
+    root.add("max_temp", value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy));
+    root.add("min_temp", value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy));
+    root.add("step", traits.get_visual_target_temperature_step());
     if (traits.get_supports_action()) {
-      root["action"] = PSTR_LOCAL(climate_action_to_string(obj->action));
-      root["state"] = root["action"];
+      const char *action = PSTR_LOCAL(climate_action_to_string(obj->action));
+      root.add("action", action);
+      root.add("state", action);
       has_state = true;
     }
     if (traits.get_supports_fan_modes() && obj->fan_mode.has_value()) {
-      root["fan_mode"] = PSTR_LOCAL(climate_fan_mode_to_string(obj->fan_mode.value()));
+      root.add("fan_mode", PSTR_LOCAL(climate_fan_mode_to_string(obj->fan_mode.value())));
     }
     if (!traits.get_supported_custom_fan_modes().empty() && obj->custom_fan_mode.has_value()) {
-      root["custom_fan_mode"] = obj->custom_fan_mode.value().c_str();
+      root.add("custom_fan_mode", obj->custom_fan_mode.value().c_str());
     }
     if (traits.get_supports_presets() && obj->preset.has_value()) {
-      root["preset"] = PSTR_LOCAL(climate_preset_to_string(obj->preset.value()));
+      root.add("preset", PSTR_LOCAL(climate_preset_to_string(obj->preset.value())));
     }
     if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
-      root["custom_preset"] = obj->custom_preset.value().c_str();
+      root.add("custom_preset", obj->custom_preset.value().c_str());
     }
     if (traits.get_supports_swing_modes()) {
-      root["swing_mode"] = PSTR_LOCAL(climate_swing_mode_to_string(obj->swing_mode));
+      root.add("swing_mode", PSTR_LOCAL(climate_swing_mode_to_string(obj->swing_mode)));
     }
     if (traits.get_supports_current_temperature()) {
       if (!std::isnan(obj->current_temperature)) {
-        root["current_temperature"] = value_accuracy_to_string(obj->current_temperature, current_accuracy);
+        root.add("current_temperature", value_accuracy_to_string(obj->current_temperature, current_accuracy));
       } else {
-        root["current_temperature"] = "NA";
+        root.add("current_temperature", "NA");
       }
     }
     if (traits.get_supports_two_point_target_temperature()) {
-      root["target_temperature_low"] = value_accuracy_to_string(obj->target_temperature_low, target_accuracy);
-      root["target_temperature_high"] = value_accuracy_to_string(obj->target_temperature_high, target_accuracy);
+      root.add("target_temperature_low", value_accuracy_to_string(obj->target_temperature_low, target_accuracy));
+      root.add("target_temperature_high", value_accuracy_to_string(obj->target_temperature_high, target_accuracy));
       if (!has_state) {
-        root["state"] = value_accuracy_to_string((obj->target_temperature_high + obj->target_temperature_low) / 2.0f,
-                                                 target_accuracy);
+        root.add("state", value_accuracy_to_string((obj->target_temperature_high + obj->target_temperature_low) / 2.0f,
+                                                   target_accuracy));
       }
     } else {
-      root["target_temperature"] = value_accuracy_to_string(obj->target_temperature, target_accuracy);
+      std::string target_temperature = value_accuracy_to_string(obj->target_temperature, target_accuracy);
+      root.add("target_temperature", target_temperature);
       if (!has_state)
-        root["state"] = root["target_temperature"];
+        root.add("state", target_temperature);
     }
   });
 }
@@ -1500,33 +1513,31 @@ void WebServer::on_lock_update(lock::Lock *obj) {
   this->events_.deferrable_send_state(obj, "state", lock_state_json_generator);
 }
 void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (lock::Lock *obj : App.get_locks()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->lock_json(obj, obj->state, detail);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "lock") {
-      this->schedule_([obj]() { obj->lock(); });
-      request->send(200);
-    } else if (match.method == "unlock") {
-      this->schedule_([obj]() { obj->unlock(); });
-      request->send(200);
-    } else if (match.method == "open") {
-      this->schedule_([obj]() { obj->open(); });
-      request->send(200);
-    } else {
-      request->send(404);
-    }
+  lock::Lock *obj = App.get_lock_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->lock_json(obj, obj->state, detail);
+    request->send(200, "application/json", data.c_str());
+  } else if (match.method == "lock") {
+    this->schedule_([obj]() { obj->lock(); });
+    request->send(200);
+  } else if (match.method == "unlock") {
+    this->schedule_([obj]() { obj->unlock(); });
+    request->send(200);
+  } else if (match.method == "open") {
+    this->schedule_([obj]() { obj->open(); });
+    request->send(200);
+  } else {
+    request->send(404);
+  }
 }
 std::string WebServer::lock_state_json_generator(WebServer *web_server, void *source) {
   return web_server->lock_json((lock::Lock *) (source), ((lock::Lock *) (source))->state, DETAIL_STATE);
@@ -1535,14 +1546,14 @@ std::string WebServer::lock_all_json_generator(WebServer *web_server, void *sour
   return web_server->lock_json((lock::Lock *) (source), ((lock::Lock *) (source))->state, DETAIL_ALL);
 }
 std::string WebServer::lock_json(lock::Lock *obj, lock::LockState value, JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
+  return json::write_json([this, obj, value, start_config](json::JsonWriter &root) {
     set_json_icon_state_value(root, obj, "lock-" + obj->get_object_id(), lock::lock_state_to_string(value), value,
                               start_config);
     if (start_config == DETAIL_ALL) {
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -1557,53 +1568,51 @@ void WebServer::on_valve_update(valve::Valve *obj) {
   this->events_.deferrable_send_state(obj, "state", valve_state_json_generator);
 }
 void WebServer::handle_valve_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (valve::Valve *obj : App.get_valves()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->valve_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-
-    auto call = obj->make_call();
-    if (match.method == "open") {
-      call.set_command_open();
-    } else if (match.method == "close") {
-      call.set_command_close();
-    } else if (match.method == "stop") {
-      call.set_command_stop();
-    } else if (match.method == "toggle") {
-      call.set_command_toggle();
-    } else if (match.method != "set") {
-      request->send(404);
-      return;
-    }
-
-    auto traits = obj->get_traits();
-    if (request->hasParam("position") && !traits.get_supports_position()) {
-      request->send(409);
-      return;
-    }
-
-    if (request->hasParam("position")) {
-      auto position = parse_number<float>(request->getParam("position")->value().c_str());
-      if (position.has_value()) {
-        call.set_position(*position);
-      }
-    }
+  valve::Valve *obj = App.get_valve_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->valve_json(obj, detail);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
 
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
+  auto call = obj->make_call();
+  if (match.method == "open") {
+    call.set_command_open();
+  } else if (match.method == "close") {
+    call.set_command_close();
+  } else if (match.method == "stop") {
+    call.set_command_stop();
+  } else if (match.method == "toggle") {
+    call.set_command_toggle();
+  } else if (match.method != "set") {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  auto traits = obj->get_traits();
+  if (request->hasParam("position") && !traits.get_supports_position()) {
+    request->send(409);
+    return;
+  }
+
+  if (request->hasParam("position")) {
+    auto position = parse_number<float>(request->getParam("position")->value().c_str());
+    if (position.has_value()) {
+      call.set_position(*position);
+    }
+  }
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
 std::string WebServer::valve_state_json_generator(WebServer *web_server, void *source) {
   return web_server->valve_json((valve::Valve *) (source), DETAIL_STATE);
@@ -1612,18 +1621,18 @@ std::string WebServer::valve_all_json_generator(WebServer *web_server, void *sou
   return web_server->valve_json((valve::Valve *) (source), DETAIL_ALL);
 }
 std::string WebServer::valve_json(valve::Valve *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
+  return json::write_json([this, obj, start_config](json::JsonWriter &root) {
     set_json_icon_state_value(root, obj, "valve-" + obj->get_object_id(), obj->is_fully_closed() ? "CLOSED" : "OPEN",
                               obj->position, start_config);
-    root["current_operation"] = valve::valve_operation_to_str(obj->current_operation);
+    root.add("current_operation", valve::valve_operation_to_str(obj->current_operation));
 
     if (obj->get_traits().get_supports_position())
-      root["position"] = obj->position;
+      root.add("position", obj->position);
     if (start_config == DETAIL_ALL) {
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -1638,46 +1647,44 @@ void WebServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlP
   this->events_.deferrable_send_state(obj, "state", alarm_control_panel_state_json_generator);
 }
 void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (alarm_control_panel::AlarmControlPanel *obj : App.get_alarm_control_panels()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->alarm_control_panel_json(obj, obj->get_state(), detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-
-    auto call = obj->make_call();
-    if (request->hasParam("code")) {
-      call.set_code(request->getParam("code")->value().c_str());  // NOLINT
-    }
-
-    if (match.method == "disarm") {
-      call.disarm();
-    } else if (match.method == "arm_away") {
-      call.arm_away();
-    } else if (match.method == "arm_home") {
-      call.arm_home();
-    } else if (match.method == "arm_night") {
-      call.arm_night();
-    } else if (match.method == "arm_vacation") {
-      call.arm_vacation();
-    } else {
-      request->send(404);
-      return;
-    }
+  alarm_control_panel::AlarmControlPanel *obj = App.get_alarm_control_panel_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->alarm_control_panel_json(obj, obj->get_state(), detail);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
 
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
+  auto call = obj->make_call();
+  if (request->hasParam("code")) {
+    call.set_code(request->getParam("code")->value().c_str());  // NOLINT
+  }
+
+  if (match.method == "disarm") {
+    call.disarm();
+  } else if (match.method == "arm_away") {
+    call.arm_away();
+  } else if (match.method == "arm_home") {
+    call.arm_home();
+  } else if (match.method == "arm_night") {
+    call.arm_night();
+  } else if (match.method == "arm_vacation") {
+    call.arm_vacation();
+  } else {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
 std::string WebServer::alarm_control_panel_state_json_generator(WebServer *web_server, void *source) {
   return web_server->alarm_control_panel_json((alarm_control_panel::AlarmControlPanel *) (source),
@@ -1692,15 +1699,15 @@ std::string WebServer::alarm_control_panel_all_json_generator(WebServer *web_ser
 std::string WebServer::alarm_control_panel_json(alarm_control_panel::AlarmControlPanel *obj,
                                                 alarm_control_panel::AlarmControlPanelState value,
                                                 JsonDetail start_config) {
-  return json::build_json([this, obj, value, start_config](JsonObject root) {
+  return json::write_json([this, obj, value, start_config](json::JsonWriter &root) {
     char buf[16];
     set_json_icon_state_value(root, obj, "alarm-control-panel-" + obj->get_object_id(),
                               PSTR_LOCAL(alarm_control_panel_state_to_string(value)), value, start_config);
     if (start_config == DETAIL_ALL) {
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -1714,20 +1721,20 @@ void WebServer::on_event(event::Event *obj, const std::string &event_type) {
 }
 
 void WebServer::handle_event_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (event::Event *obj : App.get_events()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->event_json(obj, "", detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
+  event::Event *obj = App.get_event_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->event_json(obj, "", detail);
+    request->send(200, "application/json", data.c_str());
+    return;
   }
   request->send(404);
 }
@@ -1740,21 +1747,22 @@ std::string WebServer::event_all_json_generator(WebServer *web_server, void *sou
   return web_server->event_json((event::Event *) (source), *(((event::Event *) (source))->last_event_type), DETAIL_ALL);
 }
 std::string WebServer::event_json(event::Event *obj, const std::string &event_type, JsonDetail start_config) {
-  return json::build_json([this, obj, event_type, start_config](JsonObject root) {
+  return json::write_json([this, obj, event_type, start_config](json::JsonWriter &root) {
     set_json_id(root, obj, "event-" + obj->get_object_id(), start_config);
     if (!event_type.empty()) {
-      root["event_type"] = event_type;
+      root.add("event_type", event_type);
     }
     if (start_config == DETAIL_ALL) {
-      JsonArray event_types = root.createNestedArray("event_types");
+      root.begin_array("event_types");
       for (auto const &event_type : obj->get_event_types()) {
-        event_types.add(event_type);
+        root.add(event_type);
       }
-      root["device_class"] = obj->get_device_class();
+      root.end_array();
+      root.add("device_class", obj->get_device_class());
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -1769,31 +1777,29 @@ void WebServer::on_update(update::UpdateEntity *obj) {
   this->events_.deferrable_send_state(obj, "state", update_state_json_generator);
 }
 void WebServer::handle_update_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (update::UpdateEntity *obj : App.get_updates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET && match.method.empty()) {
-      auto detail = DETAIL_STATE;
-      auto *param = request->getParam("detail");
-      if (param && param->value() == "all") {
-        detail = DETAIL_ALL;
-      }
-      std::string data = this->update_json(obj, detail);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-
-    if (match.method != "install") {
-      request->send(404);
-      return;
-    }
+  update::UpdateEntity *obj = App.get_update_by_key(fnv1_hash(match.id), true);
+  if (obj == nullptr || !obj->object_id_equals(match.id)) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET && match.method.empty()) {
+    auto detail = DETAIL_STATE;
+    auto *param = request->getParam("detail");
+    if (param && param->value() == "all") {
+      detail = DETAIL_ALL;
+    }
+    std::string data = this->update_json(obj, detail);
+    request->send(200, "application/json", data.c_str());
+    return;
+  }
 
-    this->schedule_([obj]() mutable { obj->perform(); });
-    request->send(200);
+  if (match.method != "install") {
+    request->send(404);
     return;
   }
-  request->send(404);
+
+  this->schedule_([obj]() mutable { obj->perform(); });
+  request->send(200);
 }
 std::string WebServer::update_state_json_generator(WebServer *web_server, void *source) {
   return web_server->update_json((update::UpdateEntity *) (source), DETAIL_STATE);
@@ -1802,32 +1808,32 @@ std::string WebServer::update_all_json_generator(WebServer *web_server, void *so
   return web_server->update_json((update::UpdateEntity *) (source), DETAIL_STATE);
 }
 std::string WebServer::update_json(update::UpdateEntity *obj, JsonDetail start_config) {
-  return json::build_json([this, obj, start_config](JsonObject root) {
+  return json::write_json([this, obj, start_config](json::JsonWriter &root) {
     set_json_id(root, obj, "update-" + obj->get_object_id(), start_config);
-    root["value"] = obj->update_info.latest_version;
+    root.add("value", obj->update_info.latest_version);
     switch (obj->state) {
       case update::UPDATE_STATE_NO_UPDATE:
-        root["state"] = "NO UPDATE";
+        root.add("state", "NO UPDATE");
         break;
       case update::UPDATE_STATE_AVAILABLE:
-        root["state"] = "UPDATE AVAILABLE";
+        root.add("state", "UPDATE AVAILABLE");
         break;
       case update::UPDATE_STATE_INSTALLING:
-        root["state"] = "INSTALLING";
+        root.add("state", "INSTALLING");
         break;
       default:
-        root["state"] = "UNKNOWN";
+        root.add("state", "UNKNOWN");
         break;
     }
     if (start_config == DETAIL_ALL) {
-      root["current_version"] = obj->update_info.current_version;
-      root["title"] = obj->update_info.title;
-      root["summary"] = obj->update_info.summary;
-      root["release_url"] = obj->update_info.release_url;
+      root.add("current_version", obj->update_info.current_version);
+      root.add("title", obj->update_info.title);
+      root.add("summary", obj->update_info.summary);
+      root.add("release_url", obj->update_info.release_url);
       if (this->sorting_entitys_.find(obj) != this->sorting_entitys_.end()) {
-        root["sorting_weight"] = this->sorting_entitys_[obj].weight;
+        root.add("sorting_weight", this->sorting_entitys_[obj].weight);
         if (this->sorting_groups_.find(this->sorting_entitys_[obj].group_id) != this->sorting_groups_.end()) {
-          root["sorting_group"] = this->sorting_groups_[this->sorting_entitys_[obj].group_id].name;
+          root.add("sorting_group", this->sorting_groups_[this->sorting_entitys_[obj].group_id].name);
         }
       }
     }
@@ -58,6 +58,30 @@ struct SortingGroup {
 
 enum JsonDetail { DETAIL_ALL, DETAIL_STATE };
 
+#ifdef USE_ARDUINO
+using message_generator_t = std::string(WebServer *, void *);
+#endif
+
+/** Serializes a state event once while it is handed to all connected event sources.
+ *
+ * Only the most recent message is kept, keyed by the source entity and the generator just like the deferred queues,
+ * so at most one generated message is held in memory at a time. A cache only lives for a single publish or a single
+ * pass over the deferred queues, entity states can't change during either of them. A slow client still receives only
+ * the latest state of an entity, since its deferred queue holds one entry per entity and generates the message when
+ * the entry is finally sent.
+ */
+class StateMessageCache {
+ public:
+  /// Return the message for source, generating it unless it is the cached one. The reference is valid until get() is
+  /// called again.
+  const std::string &get(WebServer *ws, void *source, message_generator_t *message_generator);
+
+ protected:
+  void *source_{nullptr};
+  message_generator_t *message_generator_{nullptr};
+  std::string message_;
+};
+
 /*
   In order to defer updates in arduino mode, we need to create one AsyncEventSource per incoming request to /events.
   This is because only minimal changes were made to the ESPAsyncWebServer lib_dep, it was undesirable to put deferred
@@ -67,8 +91,6 @@ enum JsonDetail { DETAIL_ALL, DETAIL_STATE };
   can be forgotten.
 */
 #ifdef USE_ARDUINO
-using message_generator_t = std::string(WebServer *, void *);
-
 class DeferredUpdateEventSourceList;
 class DeferredUpdateEventSource : public AsyncEventSource {
   friend class DeferredUpdateEventSourceList;
@@ -110,15 +132,17 @@ class DeferredUpdateEventSource : public AsyncEventSource {
   // helper for allowing only unique entries in the queue
   void deq_push_back_with_dedup_(void *source, message_generator_t *message_generator);
 
-  void process_deferred_queue_();
+  void process_deferred_queue_(StateMessageCache &messages);
 
  public:
   DeferredUpdateEventSource(WebServer *ws, const String &url)
       : AsyncEventSource(url), entities_iterator_(ListEntitiesIterator(ws, this)), web_server_(ws) {}
 
-  void loop();
+  void loop(StateMessageCache &messages);
 
   void deferrable_send_state(void *source, const char *event_type, message_generator_t *message_generator);
+  void deferrable_send_state(void *source, const char *event_type, message_generator_t *message_generator,
+                             StateMessageCache &messages);
   void try_send_nodefer(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
 };
 
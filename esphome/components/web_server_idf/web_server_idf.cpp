@@ -289,8 +289,10 @@ void AsyncEventSource::handleRequest(AsyncWebServerRequest *request) {
 }
 
 void AsyncEventSource::loop() {
+  // sessions draining their deferred queues in the same pass share the last generated message
+  esphome::web_server::StateMessageCache messages;
   for (auto *ses : this->sessions_) {
-    ses->loop();
+    ses->loop(messages);
   }
 }
 
@@ -302,8 +304,10 @@ void AsyncEventSource::try_send_nodefer(const char *message, const char *event,
 
 void AsyncEventSource::deferrable_send_state(void *source, const char *event_type,
                                              message_generator_t *message_generator) {
+  // serialize the state once for all sessions
+  esphome::web_server::StateMessageCache messages;
   for (auto *ses : this->sessions_) {
-    ses->deferrable_send_state(source, event_type, message_generator);
+    ses->deferrable_send_state(source, event_type, message_generator, messages);
   }
 }
 
@@ -336,9 +340,9 @@ AsyncEventSourceResponse::AsyncEventSourceResponse(const AsyncWebServerRequest *
   this->try_send_nodefer(message.c_str(), "ping", millis(), 30000);
 
   for (auto &group : ws->sorting_groups_) {
-    message = json::build_json([group](JsonObject root) {
-      root["name"] = group.second.name;
-      root["sorting_weight"] = group.second.weight;
+    message = json::write_json([group](json::JsonWriter &root) {
+      root.add("name", group.second.name);
+      root.add("sorting_weight", group.second.weight);
     });
 
     // a (very) large number of these should be able to be queued initially without defer
@@ -375,10 +379,10 @@ void AsyncEventSourceResponse::deq_push_back_with_dedup_(void *source, message_g
   }
 }
 
-void AsyncEventSourceResponse::process_deferred_queue_() {
+void AsyncEventSourceResponse::process_deferred_queue_(esphome::web_server::StateMessageCache &messages) {
   while (!deferred_queue_.empty()) {
     DeferredEvent &de = deferred_queue_.front();
-    std::string message = de.message_generator_(web_server_, de.source_);
+    const std::string &message = messages.get(web_server_, de.source_, de.message_generator_);
     if (this->try_send_nodefer(message.c_str(), "state")) {
       // O(n) but memory efficiency is more important than speed here which is why std::vector was chosen
       deferred_queue_.erase(deferred_queue_.begin());
@@ -411,9 +415,9 @@ void AsyncEventSourceResponse::process_buffer_() {
   }
 }
 
-void AsyncEventSourceResponse::loop() {
+void AsyncEventSourceResponse::loop(esphome::web_server::StateMessageCache &messages) {
   process_buffer_();
-  process_deferred_queue_();
+  process_deferred_queue_(messages);
   if (!this->entities_iterator_->completed())
     this->entities_iterator_->advance();
 }
@@ -480,7 +484,8 @@ bool AsyncEventSourceResponse::try_send_nodefer(const char *message, const char
 }
 
 void AsyncEventSourceResponse::deferrable_send_state(void *source, const char *event_type,
-                                                     message_generator_t *message_generator) {
+                                                     message_generator_t *message_generator,
+                                                     esphome::web_server::StateMessageCache &messages) {
   // allow all json "details_all" to go through before publishing bare state events, this avoids unnamed entries showing
   // up in the web GUI and reduces event load during initial connect
   if (!entities_iterator_->completed() && 0 != strcmp(event_type, "state_detail_all"))
@@ -498,14 +503,14 @@ void AsyncEventSourceResponse::deferrable_send_state(void *source, const char *e
   }
 
   process_buffer_();
-  process_deferred_queue_();
+  process_deferred_queue_(messages);
 
   if (!event_buffer_.empty() || !deferred_queue_.empty()) {
     // outgoing event buffer or deferred queue still not empty which means downstream tcp send buffer full, no point
     // trying to send first
     deq_push_back_with_dedup_(source, message_generator);
   } else {
-    std::string message = message_generator(web_server_, source);
+    const std::string &message = messages.get(web_server_, source, message_generator);
     if (!this->try_send_nodefer(message.c_str(), "state")) {
       deq_push_back_with_dedup_(source, message_generator);
     }
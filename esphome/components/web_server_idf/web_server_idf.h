@@ -15,6 +15,7 @@ namespace esphome {
 namespace web_server {
 class WebServer;
 class ListEntitiesIterator;
+class StateMessageCache;
 };  // namespace web_server
 namespace web_server_idf {
 
@@ -144,6 +145,9 @@ class AsyncWebServerRequest {
     this->init_response_(res, 200, content_type);
     return res;
   }
+  /// Start a response whose body is sent piece by piece with send_chunk(), it ends with an empty chunk.
+  void begin_chunked_response(int code, const char *content_type) { this->init_response_(nullptr, code, content_type); }
+  void send_chunk(const char *data, size_t len) { httpd_resp_send_chunk(*this, data, len); }
 
   // NOLINTNEXTLINE(readability-identifier-naming)
   bool hasParam(const std::string &name) { return this->getParam(name) != nullptr; }
@@ -253,15 +257,16 @@ class AsyncEventSourceResponse {
 
  public:
   bool try_send_nodefer(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0);
-  void deferrable_send_state(void *source, const char *event_type, message_generator_t *message_generator);
-  void loop();
+  void deferrable_send_state(void *source, const char *event_type, message_generator_t *message_generator,
+                             esphome::web_server::StateMessageCache &messages);
+  void loop(esphome::web_server::StateMessageCache &messages);
 
  protected:
   AsyncEventSourceResponse(const AsyncWebServerRequest *request, esphome::web_server_idf::AsyncEventSource *server,
                            esphome::web_server::WebServer *ws);
 
   void deq_push_back_with_dedup_(void *source, message_generator_t *message_generator);
-  void process_deferred_queue_();
+  void process_deferred_queue_(esphome::web_server::StateMessageCache &messages);
   void process_buffer_();
 
   static void destroy(void *p);
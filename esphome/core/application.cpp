@@ -3,6 +3,9 @@
 #include "esphome/core/version.h"
 #include "esphome/core/hal.h"
 
+#include <algorithm>
+#include <cinttypes>
+
 #ifdef USE_STATUS_LED
 #include "esphome/components/status_led/status_led.h"
 #endif
@@ -25,44 +28,132 @@ void Application::register_component_(Component *comp) {
   }
   this->components_.push_back(comp);
 }
+void Application::register_entity_(EntityDomain domain, EntityBase *entity) {
+  if (!this->entity_index_sorted_) {
+    // Object ids are not set yet, setup() sorts the index once they are
+    this->entity_index_.push_back({0, domain, entity});
+    return;
+  }
+  EntityIndexEntry entry{entity->get_object_id_hash(), domain, entity};
+  auto it = std::upper_bound(this->entity_index_.begin(), this->entity_index_.end(), entry,
+                             [](const EntityIndexEntry &a, const EntityIndexEntry &b) {
+                               return a.key < b.key || (a.key == b.key && a.domain < b.domain);
+                             });
+  this->entity_index_.insert(it, entry);
+}
+void Application::sort_entity_index_() {
+  for (auto &entry : this->entity_index_)
+    entry.key = entry.entity->get_object_id_hash();
+  // Stable so that entities with the same key are still found in registration order
+  std::stable_sort(this->entity_index_.begin(), this->entity_index_.end(),
+                   [](const EntityIndexEntry &a, const EntityIndexEntry &b) {
+                     return a.key < b.key || (a.key == b.key && a.domain < b.domain);
+                   });
+  this->entity_index_sorted_ = true;
+}
+EntityBase *Application::get_entity_by_key_(EntityDomain domain, uint32_t key, bool include_internal) {
+  if (!this->entity_index_sorted_) {
+    // Only before setup(), the index must not be modified here since lookups may come from other tasks
+    for (auto &entry : this->entity_index_) {
+      if (entry.domain == domain && entry.entity->get_object_id_hash() == key &&
+          (include_internal || !entry.entity->is_internal()))
+        return entry.entity;
+    }
+    return nullptr;
+  }
+  auto it = std::lower_bound(this->entity_index_.begin(), this->entity_index_.end(), key,
+                             [domain](const EntityIndexEntry &entry, uint32_t key) {
+                               return entry.key < key || (entry.key == key && entry.domain < domain);
+                             });
+  for (; it != this->entity_index_.end() && it->key == key && it->domain == domain; ++it) {
+    if (include_internal || !it->entity->is_internal())
+      return it->entity;
+  }
+  return nullptr;
+}
 void Application::setup() {
   ESP_LOGI(TAG, "Running through setup()...");
+  // All entities have been configured at this point, index them before any component can look them up
+  this->sort_entity_index_();
   ESP_LOGV(TAG, "Sorting components by setup priority...");
   std::stable_sort(this->components_.begin(), this->components_.end(), [](const Component *a, const Component *b) {
     return a->get_actual_setup_priority() > b->get_actual_setup_priority();
   });
+  // A dependency with a lower setup priority would only be set up after the component waiting for it
+  for (auto &dependency : this->setup_dependencies_) {
+    auto component = std::find(this->components_.begin(), this->components_.end(), dependency.first);
+    auto depends_on = std::find(component, this->components_.end(), dependency.second);
+    if (depends_on != this->components_.end())
+      std::rotate(component, depends_on, depends_on + 1);
+  }
 
+  [[maybe_unused]] const uint32_t setup_start = millis();
   for (uint32_t i = 0; i < this->components_.size(); i++) {
     Component *component = this->components_[i];
 
+    if (!this->can_setup_component_(component)) {
+      std::stable_sort(this->components_.begin(), this->components_.begin() + i,
+                       [](Component *a, Component *b) { return a->get_loop_priority() > b->get_loop_priority(); });
+      do {
+        this->setup_loop_(i);
+      } while (!this->can_setup_component_(component));
+    }
+
     component->call();
     this->scheduler.process_to_add();
     this->feed_wdt();
-    if (component->can_proceed())
-      continue;
+    if (!component->can_proceed())
+      this->pending_setup_.push_back(component);
+  }
 
-    std::stable_sort(this->components_.begin(), this->components_.begin() + i + 1,
+  if (!this->can_setup_component_(nullptr)) {
+    std::stable_sort(this->components_.begin(), this->components_.end(),
                      [](Component *a, Component *b) { return a->get_loop_priority() > b->get_loop_priority(); });
-
     do {
-      uint32_t new_app_state = STATUS_LED_WARNING;
-      this->scheduler.call();
-      this->feed_wdt();
-      for (uint32_t j = 0; j <= i; j++) {
-        this->components_[j]->call();
-        new_app_state |= this->components_[j]->get_component_state();
-        this->app_state_ |= new_app_state;
-        this->feed_wdt();
-      }
-      this->app_state_ = new_app_state;
-      yield();
-    } while (!component->can_proceed());
+      this->setup_loop_(this->components_.size());
+    } while (!this->can_setup_component_(nullptr));
   }
+  this->pending_setup_.shrink_to_fit();
+  this->setup_dependencies_.clear();
+  this->setup_dependencies_.shrink_to_fit();
 
-  ESP_LOGI(TAG, "setup() finished successfully!");
+  ESP_LOGI(TAG, "setup() finished successfully! (took %" PRIu32 " ms)", millis() - setup_start);
   this->schedule_dump_config();
   this->calculate_looping_components_();
 }
+bool Application::can_setup_component_(Component *component) {
+  bool can_setup = true;
+  for (auto it = this->pending_setup_.begin(); it != this->pending_setup_.end();) {
+    Component *pending = *it;
+    if (pending->can_proceed() || pending->is_failed()) {
+      it = this->pending_setup_.erase(it);
+      continue;
+    }
+    if (component == nullptr || pending->is_setup_barrier()) {
+      can_setup = false;
+    } else {
+      for (auto &dependency : this->setup_dependencies_) {
+        if (dependency.first == component && dependency.second == pending)
+          can_setup = false;
+      }
+    }
+    ++it;
+  }
+  return can_setup;
+}
+void Application::setup_loop_(uint32_t count) {
+  uint32_t new_app_state = STATUS_LED_WARNING;
+  this->scheduler.call();
+  this->feed_wdt();
+  for (uint32_t j = 0; j < count; j++) {
+    this->components_[j]->call();
+    new_app_state |= this->components_[j]->get_component_state();
+    this->app_state_ |= new_app_state;
+    this->feed_wdt();
+  }
+  this->app_state_ = new_app_state;
+  yield();
+}
 void Application::loop() {
   uint32_t new_app_state = 0;
 
@@ -4,6 +4,7 @@
 #include <vector>
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
+#include "esphome/core/entity_base.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/preferences.h"
@@ -100,89 +101,148 @@ class Application {
 #ifdef USE_BINARY_SENSOR
   void register_binary_sensor(binary_sensor::BinarySensor *binary_sensor) {
     this->binary_sensors_.push_back(binary_sensor);
+    this->register_entity_(EntityDomain::BINARY_SENSOR, binary_sensor);
   }
 #endif
 
 #ifdef USE_SENSOR
-  void register_sensor(sensor::Sensor *sensor) { this->sensors_.push_back(sensor); }
+  void register_sensor(sensor::Sensor *sensor) {
+    this->sensors_.push_back(sensor);
+    this->register_entity_(EntityDomain::SENSOR, sensor);
+  }
 #endif
 
 #ifdef USE_SWITCH
-  void register_switch(switch_::Switch *a_switch) { this->switches_.push_back(a_switch); }
+  void register_switch(switch_::Switch *a_switch) {
+    this->switches_.push_back(a_switch);
+    this->register_entity_(EntityDomain::SWITCH, a_switch);
+  }
 #endif
 
 #ifdef USE_BUTTON
-  void register_button(button::Button *button) { this->buttons_.push_back(button); }
+  void register_button(button::Button *button) {
+    this->buttons_.push_back(button);
+    this->register_entity_(EntityDomain::BUTTON, button);
+  }
 #endif
 
 #ifdef USE_TEXT_SENSOR
-  void register_text_sensor(text_sensor::TextSensor *sensor) { this->text_sensors_.push_back(sensor); }
+  void register_text_sensor(text_sensor::TextSensor *sensor) {
+    this->text_sensors_.push_back(sensor);
+    this->register_entity_(EntityDomain::TEXT_SENSOR, sensor);
+  }
 #endif
 
 #ifdef USE_FAN
-  void register_fan(fan::Fan *state) { this->fans_.push_back(state); }
+  void register_fan(fan::Fan *state) {
+    this->fans_.push_back(state);
+    this->register_entity_(EntityDomain::FAN, state);
+  }
 #endif
 
 #ifdef USE_COVER
-  void register_cover(cover::Cover *cover) { this->covers_.push_back(cover); }
+  void register_cover(cover::Cover *cover) {
+    this->covers_.push_back(cover);
+    this->register_entity_(EntityDomain::COVER, cover);
+  }
 #endif
 
 #ifdef USE_CLIMATE
-  void register_climate(climate::Climate *climate) { this->climates_.push_back(climate); }
+  void register_climate(climate::Climate *climate) {
+    this->climates_.push_back(climate);
+    this->register_entity_(EntityDomain::CLIMATE, climate);
+  }
 #endif
 
 #ifdef USE_LIGHT
-  void register_light(light::LightState *light) { this->lights_.push_back(light); }
+  void register_light(light::LightState *light) {
+    this->lights_.push_back(light);
+    this->register_entity_(EntityDomain::LIGHT, light);
+  }
 #endif
 
 #ifdef USE_NUMBER
-  void register_number(number::Number *number) { this->numbers_.push_back(number); }
+  void register_number(number::Number *number) {
+    this->numbers_.push_back(number);
+    this->register_entity_(EntityDomain::NUMBER, number);
+  }
 #endif
 
 #ifdef USE_DATETIME_DATE
-  void register_date(datetime::DateEntity *date) { this->dates_.push_back(date); }
+  void register_date(datetime::DateEntity *date) {
+    this->dates_.push_back(date);
+    this->register_entity_(EntityDomain::DATE, date);
+  }
 #endif
 
 #ifdef USE_DATETIME_TIME
-  void register_time(datetime::TimeEntity *time) { this->times_.push_back(time); }
+  void register_time(datetime::TimeEntity *time) {
+    this->times_.push_back(time);
+    this->register_entity_(EntityDomain::TIME, time);
+  }
 #endif
 
 #ifdef USE_DATETIME_DATETIME
-  void register_datetime(datetime::DateTimeEntity *datetime) { this->datetimes_.push_back(datetime); }
+  void register_datetime(datetime::DateTimeEntity *datetime) {
+    this->datetimes_.push_back(datetime);
+    this->register_entity_(EntityDomain::DATETIME, datetime);
+  }
 #endif
 
 #ifdef USE_TEXT
-  void register_text(text::Text *text) { this->texts_.push_back(text); }
+  void register_text(text::Text *text) {
+    this->texts_.push_back(text);
+    this->register_entity_(EntityDomain::TEXT, text);
+  }
 #endif
 
 #ifdef USE_SELECT
-  void register_select(select::Select *select) { this->selects_.push_back(select); }
+  void register_select(select::Select *select) {
+    this->selects_.push_back(select);
+    this->register_entity_(EntityDomain::SELECT, select);
+  }
 #endif
 
 #ifdef USE_LOCK
-  void register_lock(lock::Lock *a_lock) { this->locks_.push_back(a_lock); }
+  void register_lock(lock::Lock *a_lock) {
+    this->locks_.push_back(a_lock);
+    this->register_entity_(EntityDomain::LOCK, a_lock);
+  }
 #endif
 
 #ifdef USE_VALVE
-  void register_valve(valve::Valve *valve) { this->valves_.push_back(valve); }
+  void register_valve(valve::Valve *valve) {
+    this->valves_.push_back(valve);
+    this->register_entity_(EntityDomain::VALVE, valve);
+  }
 #endif
 
 #ifdef USE_MEDIA_PLAYER
-  void register_media_player(media_player::MediaPlayer *media_player) { this->media_players_.push_back(media_player); }
+  void register_media_player(media_player::MediaPlayer *media_player) {
+    this->media_players_.push_back(media_player);
+    this->register_entity_(EntityDomain::MEDIA_PLAYER, media_player);
+  }
 #endif
 
 #ifdef USE_ALARM_CONTROL_PANEL
   void register_alarm_control_panel(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel) {
     this->alarm_control_panels_.push_back(a_alarm_control_panel);
+    this->register_entity_(EntityDomain::ALARM_CONTROL_PANEL, a_alarm_control_panel);
   }
 #endif
 
 #ifdef USE_EVENT
-  void register_event(event::Event *event) { this->events_.push_back(event); }
+  void register_event(event::Event *event) {
+    this->events_.push_back(event);
+    this->register_entity_(EntityDomain::EVENT, event);
+  }
 #endif
 
 #ifdef USE_UPDATE
-  void register_update(update::UpdateEntity *update) { this->updates_.push_back(update); }
+  void register_update(update::UpdateEntity *update) {
+    this->updates_.push_back(update);
+    this->register_entity_(EntityDomain::UPDATE, update);
+  }
 #endif
 
   /// Register the component in this Application instance.
@@ -192,6 +252,15 @@ class Application {
     return c;
   }
 
+  /** Make component wait with its setup() until dependency can proceed.
+   *
+   * Only needed if dependency is not a setup barrier (see Component::is_setup_barrier()). If dependency has a lower
+   * setup priority than component, it is moved to be set up right before component.
+   */
+  void register_setup_dependency(Component *component, Component *dependency) {
+    this->setup_dependencies_.emplace_back(component, dependency);
+  }
+
   /// Set up all the registered components. Call this at the end of your setup() function.
   void setup();
 
@@ -246,181 +315,113 @@ class Application {
 #ifdef USE_BINARY_SENSOR
   const std::vector<binary_sensor::BinarySensor *> &get_binary_sensors() { return this->binary_sensors_; }
   binary_sensor::BinarySensor *get_binary_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->binary_sensors_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<binary_sensor::BinarySensor *>(
+        this->get_entity_by_key_(EntityDomain::BINARY_SENSOR, key, include_internal));
   }
 #endif
 #ifdef USE_SWITCH
   const std::vector<switch_::Switch *> &get_switches() { return this->switches_; }
   switch_::Switch *get_switch_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->switches_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<switch_::Switch *>(this->get_entity_by_key_(EntityDomain::SWITCH, key, include_internal));
   }
 #endif
 #ifdef USE_BUTTON
   const std::vector<button::Button *> &get_buttons() { return this->buttons_; }
   button::Button *get_button_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->buttons_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<button::Button *>(this->get_entity_by_key_(EntityDomain::BUTTON, key, include_internal));
   }
 #endif
 #ifdef USE_SENSOR
   const std::vector<sensor::Sensor *> &get_sensors() { return this->sensors_; }
   sensor::Sensor *get_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->sensors_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<sensor::Sensor *>(this->get_entity_by_key_(EntityDomain::SENSOR, key, include_internal));
   }
 #endif
 #ifdef USE_TEXT_SENSOR
   const std::vector<text_sensor::TextSensor *> &get_text_sensors() { return this->text_sensors_; }
   text_sensor::TextSensor *get_text_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->text_sensors_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<text_sensor::TextSensor *>(
+        this->get_entity_by_key_(EntityDomain::TEXT_SENSOR, key, include_internal));
   }
 #endif
 #ifdef USE_FAN
   const std::vector<fan::Fan *> &get_fans() { return this->fans_; }
   fan::Fan *get_fan_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->fans_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<fan::Fan *>(this->get_entity_by_key_(EntityDomain::FAN, key, include_internal));
   }
 #endif
 #ifdef USE_COVER
   const std::vector<cover::Cover *> &get_covers() { return this->covers_; }
   cover::Cover *get_cover_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->covers_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<cover::Cover *>(this->get_entity_by_key_(EntityDomain::COVER, key, include_internal));
   }
 #endif
 #ifdef USE_LIGHT
   const std::vector<light::LightState *> &get_lights() { return this->lights_; }
   light::LightState *get_light_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->lights_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<light::LightState *>(this->get_entity_by_key_(EntityDomain::LIGHT, key, include_internal));
   }
 #endif
 #ifdef USE_CLIMATE
   const std::vector<climate::Climate *> &get_climates() { return this->climates_; }
   climate::Climate *get_climate_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->climates_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<climate::Climate *>(this->get_entity_by_key_(EntityDomain::CLIMATE, key, include_internal));
   }
 #endif
 #ifdef USE_NUMBER
   const std::vector<number::Number *> &get_numbers() { return this->numbers_; }
   number::Number *get_number_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->numbers_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<number::Number *>(this->get_entity_by_key_(EntityDomain::NUMBER, key, include_internal));
   }
 #endif
 #ifdef USE_DATETIME_DATE
   const std::vector<datetime::DateEntity *> &get_dates() { return this->dates_; }
   datetime::DateEntity *get_date_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->dates_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<datetime::DateEntity *>(this->get_entity_by_key_(EntityDomain::DATE, key, include_internal));
   }
 #endif
 #ifdef USE_DATETIME_TIME
   const std::vector<datetime::TimeEntity *> &get_times() { return this->times_; }
   datetime::TimeEntity *get_time_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->times_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<datetime::TimeEntity *>(this->get_entity_by_key_(EntityDomain::TIME, key, include_internal));
   }
 #endif
 #ifdef USE_DATETIME_DATETIME
   const std::vector<datetime::DateTimeEntity *> &get_datetimes() { return this->datetimes_; }
   datetime::DateTimeEntity *get_datetime_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->datetimes_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<datetime::DateTimeEntity *>(
+        this->get_entity_by_key_(EntityDomain::DATETIME, key, include_internal));
   }
 #endif
 #ifdef USE_TEXT
   const std::vector<text::Text *> &get_texts() { return this->texts_; }
   text::Text *get_text_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->texts_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<text::Text *>(this->get_entity_by_key_(EntityDomain::TEXT, key, include_internal));
   }
 #endif
 #ifdef USE_SELECT
   const std::vector<select::Select *> &get_selects() { return this->selects_; }
   select::Select *get_select_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->selects_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<select::Select *>(this->get_entity_by_key_(EntityDomain::SELECT, key, include_internal));
   }
 #endif
 #ifdef USE_LOCK
   const std::vector<lock::Lock *> &get_locks() { return this->locks_; }
   lock::Lock *get_lock_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->locks_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<lock::Lock *>(this->get_entity_by_key_(EntityDomain::LOCK, key, include_internal));
   }
 #endif
 #ifdef USE_VALVE
   const std::vector<valve::Valve *> &get_valves() { return this->valves_; }
   valve::Valve *get_valve_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->valves_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<valve::Valve *>(this->get_entity_by_key_(EntityDomain::VALVE, key, include_internal));
   }
 #endif
 #ifdef USE_MEDIA_PLAYER
   const std::vector<media_player::MediaPlayer *> &get_media_players() { return this->media_players_; }
   media_player::MediaPlayer *get_media_player_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->media_players_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<media_player::MediaPlayer *>(
+        this->get_entity_by_key_(EntityDomain::MEDIA_PLAYER, key, include_internal));
   }
 #endif
 
@@ -429,33 +430,22 @@ class Application {
     return this->alarm_control_panels_;
   }
   alarm_control_panel::AlarmControlPanel *get_alarm_control_panel_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->alarm_control_panels_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<alarm_control_panel::AlarmControlPanel *>(
+        this->get_entity_by_key_(EntityDomain::ALARM_CONTROL_PANEL, key, include_internal));
   }
 #endif
 
 #ifdef USE_EVENT
   const std::vector<event::Event *> &get_events() { return this->events_; }
   event::Event *get_event_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->events_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<event::Event *>(this->get_entity_by_key_(EntityDomain::EVENT, key, include_internal));
   }
 #endif
 
 #ifdef USE_UPDATE
   const std::vector<update::UpdateEntity *> &get_updates() { return this->updates_; }
   update::UpdateEntity *get_update_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->updates_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return static_cast<update::UpdateEntity *>(this->get_entity_by_key_(EntityDomain::UPDATE, key, include_internal));
   }
 #endif
 
@@ -464,14 +454,62 @@ class Application {
  protected:
   friend Component;
 
+  /// The entity domains, entities of different domains may share the same object id.
+  enum class EntityDomain : uint8_t {
+    BINARY_SENSOR,
+    SWITCH,
+    BUTTON,
+    SENSOR,
+    TEXT_SENSOR,
+    FAN,
+    COVER,
+    LIGHT,
+    CLIMATE,
+    NUMBER,
+    DATE,
+    TIME,
+    DATETIME,
+    TEXT,
+    SELECT,
+    LOCK,
+    VALVE,
+    MEDIA_PLAYER,
+    ALARM_CONTROL_PANEL,
+    EVENT,
+    UPDATE,
+  };
+  struct EntityIndexEntry {
+    uint32_t key;
+    EntityDomain domain;
+    EntityBase *entity;
+  };
+
   void register_component_(Component *comp);
 
+  void register_entity_(EntityDomain domain, EntityBase *entity);
+  /// Sort entity_index_ by object id hash once in setup(), entities are registered before their object id is set.
+  void sort_entity_index_();
+  EntityBase *get_entity_by_key_(EntityDomain domain, uint32_t key, bool include_internal);
+
   void calculate_looping_components_();
 
+  /// Whether every pending component that component has to wait for can proceed, nullptr waits for all of them.
+  bool can_setup_component_(Component *component);
+  /// Run one setup loop iteration over the first count components while waiting for pending components.
+  void setup_loop_(uint32_t count);
+
   void feed_wdt_arch_();
 
   std::vector<Component *> components_{};
   std::vector<Component *> looping_components_{};
+  /// Components that have been set up but could not proceed yet, only used during setup().
+  std::vector<Component *> pending_setup_{};
+  /// Pairs of (component, dependency) registered with register_setup_dependency(), only used during setup().
+  std::vector<std::pair<Component *, Component *>> setup_dependencies_{};
+  /// All entities sorted by object id hash and domain, for the get_*_by_key() lookups.
+  std::vector<EntityIndexEntry> entity_index_{};
+  /// Set by setup(), entities registered afterwards are inserted in sorted position.
+  bool entity_index_sorted_{false};
 
 #ifdef USE_BINARY_SENSOR
   std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
@@ -124,6 +124,16 @@ class Component {
 
   virtual bool can_proceed();
 
+  /** Whether components with a lower setup priority have to wait for this component's can_proceed().
+   *
+   * Components that only need some time to finish their own initialization (for example a sensor waiting for
+   * its power-up delay) can return false here. Components set up after them will then be set up while they finish,
+   * unless they declared a dependency with Application::register_setup_dependency().
+   *
+   * Defaults to true.
+   */
+  virtual bool is_setup_barrier() const;
+
   bool status_has_warning() const;
 
   bool status_has_error() const;
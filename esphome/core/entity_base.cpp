@@ -53,6 +53,16 @@ std::string EntityBase::get_object_id() const {
     return this->object_id_c_str_;
   }
 }
+bool EntityBase::object_id_equals(const std::string &object_id) const {
+  if (!this->has_own_name_ && App.is_name_add_mac_suffix_enabled()) {
+    // `App.get_friendly_name()` is dynamic.
+    return this->get_object_id() == object_id;
+  }
+  if (this->object_id_c_str_ == nullptr) {
+    return object_id.empty();
+  }
+  return object_id == this->object_id_c_str_;
+}
 void EntityBase::set_object_id(const char *object_id) {
   this->object_id_c_str_ = object_id;
   this->calc_object_id_();
@@ -25,6 +25,8 @@ class EntityBase {
   // Get the sanitized name of this Entity as an ID.
   std::string get_object_id() const;
   void set_object_id(const char *object_id);
+  // Check whether object_id is the object ID of this Entity, without building a copy of it.
+  bool object_id_equals(const std::string &object_id) const;
 
   // Get the unique Object ID of this Entity
   uint32_t get_object_id_hash();
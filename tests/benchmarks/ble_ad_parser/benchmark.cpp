@@ -0,0 +1,259 @@
+// Feeds advertisement dumps through ADRecordView and ESPBTDevice. Well-formed dumps must decode to the same fields as
+// the frozen eager parser; every truncation and corrupted length byte of them must stay within the advertisement.
+// Then times a scan result that no listener inspects, a single record lookup and a full decode. Run through run.sh.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "esphome/components/esp32_ble_tracker/esp32_ble_tracker.h"
+#include "reference_parser.h"
+
+namespace esphome {
+namespace benchmark {
+
+using esp32_ble_tracker::ADRecord;
+using esp32_ble_tracker::ADRecordView;
+using esp32_ble_tracker::ESPBTDevice;
+using esp32_ble_tracker::ServiceData;
+using scan_result_t = esp_ble_gap_cb_param_t::ble_scan_result_evt_param;
+
+struct Dump {
+  const char *device;
+  const char *adv;       ///< Advertising data, hex.
+  const char *scan_rsp;  ///< Scan response data, hex.
+};
+
+// Advertisements in the layouts of common devices, with identifiers and readings replaced.
+static const Dump DUMPS[] = {
+    {"iBeacon", "0201061aff4c000215f7826da64fa24e988024bc5b71e0893e00640007c5", ""},
+    {"Eddystone UID", "0201060303aafe1716aafe00e8 5d3c7f7b4a2c6e1d9e00 000000000001 0000", ""},
+    {"Eddystone URL", "0201060303aafe0e16aafe10eb036578616d706c6507", ""},
+    {"Xiaomi LYWSD03MMC", "0201061516951e30585b0575c1a4e4a838c1a40d1004e20000", "0b094c5957534430334d4d43"},
+    {"pvvx thermometer", "1216181a38c1a4e4a8c1e4086a15440b6400ae", ""},
+    {"BTHome v2", "0201060e16d2fc4000a10164022806033215", "0b0942546f6d652d54657374"},
+    {"Govee H5075", "0d09475648353037355f31413242 030388ec 020105 09ff88ec000327706400", ""},
+    {"Nordic UART", "0201061107 9ecadc240ee5a9e093f3a3b50100406e", "0c094e6f726469635f55415254020a04031900 02"},
+    {"Apple continuity", "02011a0aff4c001005031c2a7f3b", "02 0a 0c"},
+    {"Heart rate strap", "0201060503 0d180f180319 4103", "0c09484d3132332d4865617274020a00"},
+    {"32-bit UUIDs", "0201060905 78563412 efcdab90 0920 78563412 01020304", ""},
+    {"128-bit service data",
+     "0201061521 9ecadc240ee5a9e093f3a3b50100406e 0102 0304",
+     "0708736572766963"},
+    {"Zero padded", "02010603033fff0000000000000000", ""},
+    {"Type-only record", "020106 01 09", ""},
+};
+
+static std::string hex(const std::vector<uint8_t> &data) {
+  std::string ret;
+  char buf[3];
+  for (uint8_t byte : data) {
+    snprintf(buf, sizeof(buf), "%02x", byte);
+    ret += buf;
+  }
+  return ret;
+}
+
+static std::vector<uint8_t> from_hex(const char *hex) {
+  std::vector<uint8_t> ret;
+  int nibbles = 0;
+  uint8_t value = 0;
+  for (; *hex != '\0'; hex++) {
+    if (*hex == ' ')
+      continue;
+    value = (value << 4) | static_cast<uint8_t>(strtoul(std::string(1, *hex).c_str(), nullptr, 16));
+    if (++nibbles % 2 == 0)
+      ret.push_back(value);
+  }
+  return ret;
+}
+
+// A scan result for adv followed by scan_rsp. ble_adv beyond their length is filled with fill.
+static scan_result_t scan_result(const std::vector<uint8_t> &adv, const std::vector<uint8_t> &scan_rsp,
+                                 uint8_t fill) {
+  scan_result_t param{};
+  static const esp_bd_addr_t ADDRESS = {0xa4, 0xc1, 0x38, 0x12, 0x34, 0x56};
+  memcpy(param.bda, ADDRESS, sizeof(ADDRESS));
+  param.ble_addr_type = BLE_ADDR_TYPE_PUBLIC;
+  param.rssi = -67;
+  memset(param.ble_adv, fill, sizeof(param.ble_adv));
+  memcpy(param.ble_adv, adv.data(), adv.size());
+  memcpy(param.ble_adv + adv.size(), scan_rsp.data(), scan_rsp.size());
+  param.adv_data_len = adv.size();
+  param.scan_rsp_len = scan_rsp.size();
+  return param;
+}
+
+// Decoded fields of an advertisement as text, for comparing and printing.
+template<typename T> static std::string describe(const T &ad) {
+  std::string ret = "name '" + ad.name_ + "'";
+  for (int8_t tx_power : ad.tx_powers_)
+    ret += ", tx power " + std::to_string(tx_power);
+  if (ad.appearance_.has_value())
+    ret += ", appearance " + std::to_string(*ad.appearance_);
+  if (ad.ad_flag_.has_value())
+    ret += ", flags " + std::to_string(*ad.ad_flag_);
+  for (const auto &uuid : ad.service_uuids_)
+    ret += ", service " + uuid.to_string();
+  for (const auto &data : ad.manufacturer_datas_)
+    ret += ", manufacturer " + data.uuid.to_string() + " " + hex(data.data);
+  for (const auto &data : ad.service_datas_)
+    ret += ", service data " + data.uuid.to_string() + " " + hex(data.data);
+  return ret;
+}
+
+// The decoded fields of a device, read through its public getters.
+struct DeviceFields {
+  explicit DeviceFields(const ESPBTDevice &device)
+      : name_(device.get_name()),
+        tx_powers_(device.get_tx_powers()),
+        appearance_(device.get_appearance()),
+        ad_flag_(device.get_ad_flag()),
+        service_uuids_(device.get_service_uuids()),
+        manufacturer_datas_(device.get_manufacturer_datas()),
+        service_datas_(device.get_service_datas()) {}
+
+  std::string name_;
+  std::vector<int8_t> tx_powers_;
+  optional<uint16_t> appearance_;
+  optional<uint8_t> ad_flag_;
+  std::vector<esp32_ble::ESPBTUUID> service_uuids_;
+  std::vector<ServiceData> manufacturer_datas_;
+  std::vector<ServiceData> service_datas_;
+};
+
+// Walk length bytes at data through ADRecordView, failing if a record reaches outside of them.
+static bool records_in_bounds(const uint8_t *data, size_t length, size_t &records) {
+  for (const ADRecord &record : ADRecordView(data, length)) {
+    if (record.data < data + 2 || record.data + record.length > data + length)
+      return false;
+    records++;
+  }
+  return true;
+}
+
+// Compare a well-formed dump against the frozen parser. The frozen parser stored the first byte of the advertisement
+// as TX power, so TX powers are compared against the TX power records instead.
+static bool check_well_formed(const Dump &dump) {
+  scan_result_t param = scan_result(from_hex(dump.adv), from_hex(dump.scan_rsp), 0);
+  ESPBTDevice device;
+  device.parse_scan_rst(param);
+  DeviceFields actual(device);
+
+  ble_reference::ParsedAdvertisement expected;
+  expected.parse_adv_(param);
+  expected.tx_powers_.clear();
+  for (const ADRecord &record : device.get_ad_records()) {
+    if (record.type == ESP_BLE_AD_TYPE_TX_PWR)
+      expected.tx_powers_.push_back(record.data[0]);
+  }
+
+  if (describe(actual) != describe(expected)) {
+    fprintf(stderr, "%s decodes differently:\n  expected %s\n  actual   %s\n", dump.device,
+            describe(expected).c_str(), describe(actual).c_str());
+    return false;
+  }
+  return true;
+}
+
+// Parse data, which is cut or corrupted, twice with different bytes after its end. Both parses must decode the same
+// fields, and every record must lie within the data.
+static bool check_damaged(const char *device, const std::vector<uint8_t> &data, size_t &records) {
+  // an exactly sized copy, so that reading past the end shows up when built with -fsanitize=address
+  std::vector<uint8_t> exact(data);
+  if (!records_in_bounds(exact.data(), exact.size(), records)) {
+    fprintf(stderr, "%s: record outside of %zu bytes %s\n", device, data.size(), hex(data).c_str());
+    return false;
+  }
+
+  std::string decoded[2];
+  for (int i = 0; i < 2; i++) {
+    scan_result_t param = scan_result(data, {}, i == 0 ? 0x00 : 0xff);
+    ESPBTDevice parsed;
+    parsed.parse_scan_rst(param);
+    decoded[i] = describe(DeviceFields(parsed));
+  }
+  if (decoded[0] != decoded[1]) {
+    fprintf(stderr, "%s: decoding depends on bytes after %s\n  %s\n  %s\n", device, hex(data).c_str(),
+            decoded[0].c_str(), decoded[1].c_str());
+    return false;
+  }
+  return true;
+}
+
+template<typename F> static double time_per_advertisement(const std::vector<scan_result_t> &params, int rounds,
+                                                          F &&inspect) {
+  ESPBTDevice device;
+  auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; round++) {
+    for (const auto &param : params) {
+      device.parse_scan_rst(param);
+      inspect(device);
+    }
+  }
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::nano>(elapsed).count() / (static_cast<double>(rounds) * params.size());
+}
+
+}  // namespace benchmark
+}  // namespace esphome
+
+using namespace esphome;
+using namespace esphome::benchmark;
+
+int main(int argc, char **argv) {
+  int rounds = argc > 1 ? atoi(argv[1]) : 20000;
+
+  size_t damaged = 0, records = 0;
+  for (const Dump &dump : DUMPS) {
+    if (!check_well_formed(dump))
+      return 1;
+
+    std::vector<uint8_t> data = from_hex(dump.adv);
+    std::vector<uint8_t> scan_rsp = from_hex(dump.scan_rsp);
+    data.insert(data.end(), scan_rsp.begin(), scan_rsp.end());
+    // every truncation
+    for (size_t length = 0; length <= data.size(); length++, damaged++) {
+      if (!check_damaged(dump.device, std::vector<uint8_t>(data.begin(), data.begin() + length), records))
+        return 1;
+    }
+    // every byte read as a record length, set to each value that overruns or shortens the record
+    for (size_t offset = 0; offset < data.size(); offset++) {
+      for (int value : {0, 1, 2, 3, 0x10, 0x1f, 0x3e, 0xff}) {
+        std::vector<uint8_t> corrupted(data);
+        corrupted[offset] = value;
+        if (!check_damaged(dump.device, corrupted, records))
+          return 1;
+        damaged++;
+      }
+    }
+  }
+  printf("%zu dumps decode identically, %zu truncated or corrupted copies stay in bounds (%zu records)\n",
+         sizeof(DUMPS) / sizeof(DUMPS[0]), damaged, records);
+
+  std::vector<scan_result_t> params;
+  for (const Dump &dump : DUMPS)
+    params.push_back(scan_result(from_hex(dump.adv), from_hex(dump.scan_rsp), 0));
+
+  size_t sink = 0;
+  double reference = time_per_advertisement(params, rounds, [&sink](const ESPBTDevice &device) {
+    ble_reference::ParsedAdvertisement parsed;
+    parsed.parse_adv_(device.get_scan_result());
+    sink += parsed.service_uuids_.size() + parsed.manufacturer_datas_.size();
+  });
+  double uninspected = time_per_advertisement(
+      params, rounds, [&sink](const ESPBTDevice &device) { sink += device.address_uint64() & 1; });
+  double lookup = time_per_advertisement(params, rounds, [&sink](const ESPBTDevice &device) {
+    auto record = device.get_ad_records().find(ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE);
+    sink += record.has_value() ? record->length : 0;
+  });
+  double decoded = time_per_advertisement(params, rounds, [&sink](const ESPBTDevice &device) {
+    sink += device.get_service_uuids().size() + device.get_manufacturer_datas().size();
+  });
+  printf("per advertisement: eager reference %.0f ns, uninspected %.0f ns, one record lookup %.0f ns, "
+         "full decode %.0f ns (%zu)\n",
+         reference, uninspected, lookup, decoded, sink % 10);
+  return 0;
+}
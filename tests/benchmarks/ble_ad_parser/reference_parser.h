@@ -0,0 +1,27 @@
+// Frozen copy of ESPBTDevice::parse_adv_() as it was before the record view, decoding every field eagerly. The
+// benchmark compares the current adaptor against it on well-formed advertisements; do not modify.
+#pragma once
+#include <string>
+#include <vector>
+
+#include "esphome/components/esp32_ble_tracker/esp32_ble_tracker.h"
+
+namespace esphome {
+namespace ble_reference {
+
+using esp32_ble_tracker::ServiceData;
+
+struct ParsedAdvertisement {
+  std::string name_;
+  std::vector<int8_t> tx_powers_;
+  optional<uint16_t> appearance_;
+  optional<uint8_t> ad_flag_;
+  std::vector<esp32_ble::ESPBTUUID> service_uuids_;
+  std::vector<ServiceData> manufacturer_datas_;
+  std::vector<ServiceData> service_datas_;
+
+  void parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
+};
+
+}  // namespace ble_reference
+}  // namespace esphome
@@ -0,0 +1,24 @@
+#!/usr/bin/env bash
+# Builds the BLE advertisement parser host benchmark and runs it. Exits non-zero if a well-formed advertisement
+# decodes differently from the reference parser, or if a truncated or corrupted one is read out of bounds. Extra
+# compiler flags can be passed in CXXFLAGS, e.g. CXXFLAGS=-fsanitize=address.
+#
+#   tests/benchmarks/ble_ad_parser/run.sh [rounds]
+
+set -euo pipefail
+
+here="$(cd "$(dirname "$0")" && pwd)"
+root="$(cd "$here/../../.." && pwd)"
+out="${TMPDIR:-/tmp}/ble-ad-parser-benchmark"
+
+sources=(
+  "$here/benchmark.cpp"
+  "$here/reference_parser.cpp"
+  "$here/stubs/host_stubs.cpp"
+  "$root/esphome/components/esp32_ble_tracker/esp_bt_device.cpp"
+  "$root/esphome/components/esp32_ble/ble_uuid.cpp"
+)
+
+"${CXX:-g++}" -std=gnu++17 -O2 -w -DUSE_ESP32 ${CXXFLAGS:-} -I"$here/stubs" -I"$here" -I"$root" "${sources[@]}" \
+  -o "$out"
+"$out" "$@"
@@ -0,0 +1,71 @@
+// Host stand-in for the ESP-IDF GAP types a scan result is delivered in. Values mirror ESP-IDF.
+#pragma once
+#include <cstdint>
+
+#include "esp_bt_defs.h"
+
+typedef enum {
+  ESP_BLE_AD_TYPE_FLAG = 0x01,
+  ESP_BLE_AD_TYPE_16SRV_PART = 0x02,
+  ESP_BLE_AD_TYPE_16SRV_CMPL = 0x03,
+  ESP_BLE_AD_TYPE_32SRV_PART = 0x04,
+  ESP_BLE_AD_TYPE_32SRV_CMPL = 0x05,
+  ESP_BLE_AD_TYPE_128SRV_PART = 0x06,
+  ESP_BLE_AD_TYPE_128SRV_CMPL = 0x07,
+  ESP_BLE_AD_TYPE_NAME_SHORT = 0x08,
+  ESP_BLE_AD_TYPE_NAME_CMPL = 0x09,
+  ESP_BLE_AD_TYPE_TX_PWR = 0x0A,
+  ESP_BLE_AD_TYPE_INT_RANGE = 0x12,
+  ESP_BLE_AD_TYPE_SERVICE_DATA = 0x16,
+  ESP_BLE_AD_TYPE_APPEARANCE = 0x19,
+  ESP_BLE_AD_TYPE_32SERVICE_DATA = 0x20,
+  ESP_BLE_AD_TYPE_128SERVICE_DATA = 0x21,
+  ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE = 0xFF,
+} esp_ble_adv_data_type;
+
+#define ESP_BLE_ADV_DATA_LEN_MAX 31
+#define ESP_BLE_SCAN_RSP_DATA_LEN_MAX 31
+
+typedef enum {
+  ESP_GAP_SEARCH_INQ_RES_EVT = 0,
+  ESP_GAP_SEARCH_INQ_CMPL_EVT = 1,
+} esp_gap_search_evt_t;
+
+typedef enum {
+  ESP_GAP_BLE_SCAN_RESULT_EVT = 3,
+} esp_gap_ble_cb_event_t;
+
+typedef struct {
+  uint8_t scan_type;
+  uint8_t own_addr_type;
+  uint8_t scan_filter_policy;
+  uint16_t scan_interval;
+  uint16_t scan_window;
+  uint8_t scan_duplicate;
+} esp_ble_scan_params_t;
+
+typedef union {
+  struct ble_scan_result_evt_param {
+    esp_gap_search_evt_t search_evt;
+    esp_bd_addr_t bda;
+    uint8_t dev_type;
+    esp_ble_addr_type_t ble_addr_type;
+    uint8_t ble_evt_type;
+    int rssi;
+    uint8_t ble_adv[ESP_BLE_ADV_DATA_LEN_MAX + ESP_BLE_SCAN_RSP_DATA_LEN_MAX];
+    int flag;
+    int num_resps;
+    uint8_t adv_data_len;
+    uint8_t scan_rsp_len;
+    uint32_t num_dis;
+  } scan_rst;
+  struct ble_scan_param_cmpl_evt_param {
+    esp_bt_status_t status;
+  } scan_param_cmpl;
+  struct ble_scan_start_cmpl_evt_param {
+    esp_bt_status_t status;
+  } scan_start_cmpl;
+  struct ble_scan_stop_cmpl_evt_param {
+    esp_bt_status_t status;
+  } scan_stop_cmpl;
+} esp_ble_gap_cb_param_t;
@@ -0,0 +1,11 @@
+// Host stand-in for the ESP-IDF GATT client types named in the tracker's interfaces.
+#pragma once
+#include <cstdint>
+
+typedef uint8_t esp_gatt_if_t;
+typedef enum {
+  ESP_GATTC_REG_EVT = 0,
+} esp_gattc_cb_event_t;
+typedef union {
+  uint8_t unused;
+} esp_ble_gattc_cb_param_t;
@@ -0,0 +1,13 @@
+// Host stand-in for the ESP-IDF heap API referenced by RAMAllocator.
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+inline void *heap_caps_malloc(size_t size, uint32_t caps) { return malloc(size); }
+inline size_t heap_caps_get_free_size(uint32_t caps) { return 0; }
+inline size_t heap_caps_get_largest_free_block(uint32_t caps) { return 0; }
@@ -0,0 +1,35 @@
+// Host stand-in for the ESP32 BLE component header. Declares only what esp32_ble_tracker.h builds on, so the
+// advertisement parser can be compiled without the Bluetooth stack.
+#pragma once
+
+#include "esphome/components/esp32_ble/ble_uuid.h"
+#include "esphome/core/component.h"
+
+#include <esp_gap_ble_api.h>
+#include <esp_gattc_api.h>
+
+namespace esphome {
+namespace esp32_ble {
+
+uint64_t ble_addr_to_uint64(const esp_bd_addr_t address);
+
+class GAPEventHandler {
+ public:
+  virtual void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *param) = 0;
+};
+
+class GATTcEventHandler {
+ public:
+  virtual void gattc_event_handler(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if,
+                                   esp_ble_gattc_cb_param_t *param) = 0;
+};
+
+class BLEStatusEventHandler {
+ public:
+  virtual void ble_before_disabled_event_handler() = 0;
+};
+
+class ESP32BLE : public Component {};
+
+}  // namespace esp32_ble
+}  // namespace esphome
@@ -0,0 +1,6 @@
+// Host configuration for the BLE advertisement parser benchmark. run.sh defines USE_ESP32, like the ESP32 platform
+// does through its build flags, but no framework.
+#pragma once
+#include "esphome/core/macros.h"
+
+#define ESPHOME_LOG_LEVEL ESPHOME_LOG_LEVEL_NONE
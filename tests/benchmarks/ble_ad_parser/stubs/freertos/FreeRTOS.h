@@ -0,0 +1,2 @@
+// Host stand-in for FreeRTOS; the parser benchmark runs single threaded.
+#pragma once
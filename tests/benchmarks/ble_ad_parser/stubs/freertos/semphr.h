@@ -0,0 +1,4 @@
+// Host stand-in for the FreeRTOS semaphore handle type.
+#pragma once
+
+typedef void *SemaphoreHandle_t;
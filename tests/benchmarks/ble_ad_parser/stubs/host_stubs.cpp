@@ -0,0 +1,35 @@
+// Definitions the parser needs from outside esp32_ble_tracker when linked into a plain host executable. helpers.cpp
+// cannot be built for USE_ESP32 without the framework, so the one helper ESPBTUUID uses is copied here.
+#include <cstdarg>
+#include <cstdio>
+
+#include "esphome/components/esp32_ble/ble.h"
+
+namespace esphome {
+
+std::string str_snprintf(const char *fmt, size_t len, ...) {
+  std::string str;
+  va_list args;
+
+  str.resize(len);
+  va_start(args, len);
+  size_t out_length = vsnprintf(&str[0], len + 1, fmt, args);
+  va_end(args);
+
+  if (out_length < len)
+    str.resize(out_length);
+
+  return str;
+}
+
+namespace esp32_ble {
+
+uint64_t ble_addr_to_uint64(const esp_bd_addr_t address) {
+  uint64_t u = 0;
+  for (int i = 0; i < ESP_BD_ADDR_LEN; i++)
+    u = (u << 8) | address[i];
+  return u;
+}
+
+}  // namespace esp32_ble
+}  // namespace esphome
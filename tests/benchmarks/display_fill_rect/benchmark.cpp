@@ -0,0 +1,403 @@
+// Fills random rectangles, partly off screen and partly outside a clipping rectangle, through fill_rect() on one
+// instance of each buffered driver and pixel by pixel through draw_pixel_at() on another, for all four rotations.
+// The buffers must stay identical and, for the TFT drivers, every changed pixel must be inside a dirty region.
+// Random alpha bitmaps, as drawn for font glyphs, must likewise match the clipped runs of
+// Display::draw_alpha_bitmap_at(). Then times both ways on the rectangles typical for widgets and on glyphs.
+// Run through run.sh.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "esphome/components/ili9xxx/ili9xxx_display.h"
+#include "esphome/components/ssd1306_base/ssd1306_base.h"
+#include "esphome/components/st7735/st7735.h"
+#include "esphome/components/st7789v/st7789v.h"
+
+namespace esphome {
+namespace benchmark {
+
+using display::DisplayRotation;
+
+static const DisplayRotation ROTATIONS[] = {display::DISPLAY_ROTATION_0_DEGREES, display::DISPLAY_ROTATION_90_DEGREES,
+                                            display::DISPLAY_ROTATION_180_DEGREES,
+                                            display::DISPLAY_ROTATION_270_DEGREES};
+
+// The shipped ILI9XXX driver without a bus. The buffer is allocated on first use, like on the device.
+class HostILI9XXX : public ili9xxx::ILI9XXXDisplay {
+ public:
+  HostILI9XXX(int16_t width, int16_t height, ili9xxx::ILI9XXXColorMode mode) {
+    this->set_dimensions(width, height);
+    this->set_buffer_color_mode(mode);
+  }
+  void command(uint8_t value) override {}
+  void data(uint8_t value) override {}
+
+  static const bool TRACKS_DIRTY_REGIONS = true;
+  bool clear() {
+    if (!this->check_buffer_())
+      return false;
+    memset(this->buffer_, 0, this->buffer_size());
+    this->dirty_regions_.clear();
+    return true;
+  }
+  size_t buffer_size() {
+    return this->get_buffer_length_() * (this->buffer_color_mode_ == ili9xxx::BITS_16 ? 2 : 1);
+  }
+  size_t bytes_per_pixel() const { return this->buffer_color_mode_ == ili9xxx::BITS_16 ? 2 : 1; }
+  const uint8_t *buffer() const { return this->buffer_; }
+  const display::DirtyRegions &dirty_regions() const { return this->dirty_regions_; }
+  void clear_dirty_regions() { this->dirty_regions_.clear(); }
+  int native_width() { return this->get_width_internal(); }
+};
+
+// The shipped SSD1306 buffer handling without a bus.
+class HostSSD1306 : public ssd1306_base::SSD1306 {
+ public:
+  explicit HostSSD1306(ssd1306_base::SSD1306Model model) { this->set_model(model); }
+
+  static const bool TRACKS_DIRTY_REGIONS = false;
+  bool clear() {
+    if (this->buffer_ == nullptr)
+      this->init_internal_(this->get_buffer_length_());
+    if (this->buffer_ == nullptr)
+      return false;
+    memset(this->buffer_, 0, this->buffer_size());
+    return true;
+  }
+  size_t buffer_size() { return this->get_buffer_length_(); }
+  const uint8_t *buffer() const { return this->buffer_; }
+
+ protected:
+  void command(uint8_t value) override {}
+  void write_display_data(const uint8_t *data, size_t length) override {}
+};
+
+// The shipped ST7789V buffer handling without a bus.
+class HostST7789V : public st7789v::ST7789V {
+ public:
+  HostST7789V(int16_t width, int16_t height, bool eightbitcolor) {
+    this->set_width(width);
+    this->set_height(height);
+    this->set_eightbitcolor(eightbitcolor);
+  }
+
+  static const bool TRACKS_DIRTY_REGIONS = true;
+  bool clear() {
+    if (this->buffer_ == nullptr)
+      this->init_internal_(this->get_buffer_length_());
+    if (this->buffer_ == nullptr)
+      return false;
+    memset(this->buffer_, 0, this->buffer_size());
+    this->dirty_regions_.clear();
+    return true;
+  }
+  size_t buffer_size() { return this->get_buffer_length_(); }
+  size_t bytes_per_pixel() const { return this->eightbitcolor_ ? 1 : 2; }
+  const uint8_t *buffer() const { return this->buffer_; }
+  const display::DirtyRegions &dirty_regions() const { return this->dirty_regions_; }
+  void clear_dirty_regions() { this->dirty_regions_.clear(); }
+  int native_width() { return this->get_width_internal(); }
+};
+
+// The shipped ST7735 buffer handling without a bus, which draws every pixel through the DisplayBuffer defaults.
+class HostST7735 : public st7735::ST7735 {
+ public:
+  HostST7735(int width, int height, bool eightbitcolor)
+      : st7735::ST7735(st7735::ST7735_INITR_18BLACKTAB, width, height, 0, 0, eightbitcolor, false, false) {}
+
+  static const bool TRACKS_DIRTY_REGIONS = true;
+  bool clear() {
+    if (this->buffer_ == nullptr)
+      this->init_internal_(this->get_buffer_length());
+    if (this->buffer_ == nullptr)
+      return false;
+    memset(this->buffer_, 0, this->buffer_size());
+    this->dirty_regions_.clear();
+    return true;
+  }
+  size_t buffer_size() { return this->get_buffer_length(); }
+  size_t bytes_per_pixel() const { return this->eightbitcolor_ ? 1 : 2; }
+  const uint8_t *buffer() const { return this->buffer_; }
+  const display::DirtyRegions &dirty_regions() const { return this->dirty_regions_; }
+  void clear_dirty_regions() { this->dirty_regions_.clear(); }
+  int native_width() { return this->get_width_internal(); }
+};
+
+static int degrees(DisplayRotation rotation) { return static_cast<int>(rotation); }
+
+// What fill_rect() did before drivers could override it, and what every other driver still does.
+static void per_pixel_rect(display::Display &display, int x, int y, int width, int height, Color color) {
+  for (int j = y; j < y + height; j++) {
+    for (int i = x; i < x + width; i++)
+      display.draw_pixel_at(i, j, color);
+  }
+}
+
+// A uniformly distributed value in [low, high].
+static int random_int(std::mt19937 &rng, int low, int high) {
+  return std::uniform_int_distribution<int>(low, high)(rng);
+}
+
+static Color random_color(std::mt19937 &rng) {
+  // black often enough that monochrome pixels are switched off as well as on
+  if (random_int(rng, 0, 2) == 0)
+    return Color::BLACK;
+  return Color(random_int(rng, 0, 255), random_int(rng, 0, 255), random_int(rng, 0, 255));
+}
+
+// Every pixel that differs between before and after must lie in one of the display's dirty regions.
+template<typename D> static bool dirty_regions_cover(D &display, const std::vector<uint8_t> &before) {
+  const size_t bpp = display.bytes_per_pixel();
+  const int width = display.native_width();
+  const int height = display.buffer_size() / bpp / width;
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      size_t pos = (static_cast<size_t>(y) * width + x) * bpp;
+      if (memcmp(before.data() + pos, display.buffer() + pos, bpp) == 0)
+        continue;
+      bool covered = false;
+      for (const display::Rect &region : display.dirty_regions())
+        covered |= region.inside(x, y);
+      if (!covered) {
+        fprintf(stderr, "changed pixel %d,%d is outside of the dirty regions\n", x, y);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Draw the same random rectangles on both displays, through fill_rect() and pixel by pixel, comparing the buffers
+// after each one.
+template<typename D> static bool check_rectangles(const char *name, D &fast, D &slow, int rectangles) {
+  if (!fast.clear() || !slow.clear()) {
+    fprintf(stderr, "%s: could not allocate the buffer\n", name);
+    return false;
+  }
+  std::mt19937 rng(1);
+  for (DisplayRotation rotation : ROTATIONS) {
+    fast.set_rotation(rotation);
+    slow.set_rotation(rotation);
+    const int width = fast.get_width();
+    const int height = fast.get_height();
+    std::vector<uint8_t> before;
+    for (int i = 0; i < rectangles; i++) {
+      // sometimes within a clipping rectangle, which may itself reach off screen
+      bool clipping = random_int(rng, 0, 3) == 0;
+      if (clipping) {
+        display::Rect clip(random_int(rng, -10, width + 10), random_int(rng, -10, height + 10),
+                           random_int(rng, 1, width), random_int(rng, 1, height));
+        fast.start_clipping(clip);
+        slow.start_clipping(clip);
+      }
+      // a quarter of the rectangles are single rows or columns, as drawn for lines and outlines
+      int x = random_int(rng, -20, width + 20);
+      int y = random_int(rng, -20, height + 20);
+      int w = random_int(rng, 0, 7) == 0 ? 1 : random_int(rng, -2, width + 10);
+      int h = random_int(rng, 0, 7) == 0 ? 1 : random_int(rng, -2, height + 10);
+      Color color = random_color(rng);
+
+      if constexpr (D::TRACKS_DIRTY_REGIONS) {
+        before.assign(fast.buffer(), fast.buffer() + fast.buffer_size());
+        fast.clear_dirty_regions();
+      }
+      fast.fill_rect(x, y, w, h, color);
+      per_pixel_rect(slow, x, y, w, h, color);
+      if (clipping) {
+        fast.end_clipping();
+        slow.end_clipping();
+      }
+
+      if (memcmp(fast.buffer(), slow.buffer(), fast.buffer_size()) != 0) {
+        fprintf(stderr, "%s, rotation %d: fill_rect(%d, %d, %d, %d) differs from drawing each pixel%s\n", name,
+                degrees(rotation), x, y, w, h, clipping ? " while clipping" : "");
+        return false;
+      }
+      if constexpr (D::TRACKS_DIRTY_REGIONS) {
+        if (!dirty_regions_cover(fast, before)) {
+          fprintf(stderr, "%s, rotation %d: after fill_rect(%d, %d, %d, %d)\n", name, degrees(rotation), x, y, w, h);
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+static const uint8_t BPPS[] = {1, 2, 4, 8};
+
+static std::vector<uint8_t> random_bitmap(std::mt19937 &rng, int width, int height, uint8_t bpp) {
+  std::vector<uint8_t> data((width * height * bpp + 7) / 8);
+  for (auto &byte : data)
+    byte = random_int(rng, 0, 255);
+  return data;
+}
+
+// Draw the same random alpha bitmaps on both displays, through the driver and through the clipped runs of the
+// Display default, comparing the buffers after each one.
+template<typename D> static bool check_alpha_bitmaps(const char *name, D &fast, D &slow, int bitmaps) {
+  if (!fast.clear() || !slow.clear()) {
+    fprintf(stderr, "%s: could not allocate the buffer\n", name);
+    return false;
+  }
+  std::mt19937 rng(2);
+  for (DisplayRotation rotation : ROTATIONS) {
+    fast.set_rotation(rotation);
+    slow.set_rotation(rotation);
+    const int width = fast.get_width();
+    const int height = fast.get_height();
+    for (int i = 0; i < bitmaps; i++) {
+      bool clipping = random_int(rng, 0, 3) == 0;
+      if (clipping) {
+        display::Rect clip(random_int(rng, 0, width / 2), random_int(rng, 0, height / 2), random_int(rng, 1, width),
+                           random_int(rng, 1, height));
+        fast.start_clipping(clip);
+        slow.start_clipping(clip);
+      }
+      // mostly fully on screen, some cut by the edges
+      uint8_t bpp = BPPS[random_int(rng, 0, 3)];
+      int w = random_int(rng, 1, 40);
+      int h = random_int(rng, 1, 40);
+      int x = random_int(rng, -10, width - w / 2);
+      int y = random_int(rng, -10, height - h / 2);
+      std::vector<uint8_t> data = random_bitmap(rng, w, h, bpp);
+      Color color = random_color(rng);
+      Color background = random_color(rng);
+
+      std::vector<uint8_t> before;
+      if constexpr (D::TRACKS_DIRTY_REGIONS) {
+        before.assign(fast.buffer(), fast.buffer() + fast.buffer_size());
+        fast.clear_dirty_regions();
+      }
+      fast.draw_alpha_bitmap_at(x, y, w, h, data.data(), bpp, color, background);
+      slow.display::Display::draw_alpha_bitmap_at(x, y, w, h, data.data(), bpp, color, background);
+      if (clipping) {
+        fast.end_clipping();
+        slow.end_clipping();
+      }
+
+      if (memcmp(fast.buffer(), slow.buffer(), fast.buffer_size()) != 0) {
+        fprintf(stderr, "%s, rotation %d: %d bpp bitmap %dx%d at %d,%d differs from the clipped runs%s\n", name,
+                degrees(rotation), bpp, w, h, x, y, clipping ? " while clipping" : "");
+        return false;
+      }
+      if constexpr (D::TRACKS_DIRTY_REGIONS) {
+        if (!dirty_regions_cover(fast, before)) {
+          fprintf(stderr, "%s, rotation %d: after a %d bpp bitmap %dx%d at %d,%d\n", name, degrees(rotation), bpp, w,
+                  h, x, y);
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+struct Shape {
+  const char *name;
+  int width;   ///< Width of the rectangle, or 0 for the full display width.
+  int height;  ///< Height of the rectangle, or 0 for the full display height.
+};
+
+// A full screen clear, a button background and a horizontal line, alternating between two colors so that every
+// fill changes the buffer.
+static const Shape SHAPES[] = {{"full screen", 0, 0}, {"100x40", 100, 40}, {"1-pixel line", 100, 1}};
+
+template<typename F> static double time_fills(display::Display &display, int width, int height, int rounds, F &&fill) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++)
+    fill(display, 4, 4, width, height, i % 2 == 0 ? Color(0x20, 0x80, 0xff) : Color::BLACK);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::micro>(elapsed).count() / rounds;
+}
+
+template<typename D> static void time_shapes(const char *name, D &display, int rounds) {
+  display.clear();
+  for (DisplayRotation rotation : ROTATIONS) {
+    display.set_rotation(rotation);
+    for (const Shape &shape : SHAPES) {
+      int width = shape.width == 0 ? display.get_width() - 8 : shape.width;
+      int height = shape.height == 0 ? display.get_height() - 8 : shape.height;
+      double reference = time_fills(display, width, height, rounds, per_pixel_rect);
+      double current = time_fills(display, width, height, rounds,
+                                  [](display::Display &d, int x, int y, int w, int h, Color c) {
+                                    d.fill_rect(x, y, w, h, c);
+                                  });
+      printf("%-16s rotation %3d, %-12s per pixel %8.2f us, fill_rect %7.2f us\n", name, degrees(rotation),
+             shape.name, reference, current);
+    }
+  }
+}
+
+// A 16x24 glyph, drawn without rotation at 1 and 4 bpp.
+template<typename D> static void time_glyphs(const char *name, D &display, int rounds) {
+  display.clear();
+  display.set_rotation(display::DISPLAY_ROTATION_0_DEGREES);
+  std::mt19937 rng(3);
+  for (uint8_t bpp : {1, 4}) {
+    std::vector<uint8_t> data = random_bitmap(rng, 16, 24, bpp);
+    double times[2];
+    for (int current = 0; current != 2; current++) {
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < rounds * 10; i++) {
+        Color color = i % 2 == 0 ? Color(0x20, 0x80, 0xff) : Color::WHITE;
+        if (current) {
+          display.draw_alpha_bitmap_at(4, 4, 16, 24, data.data(), bpp, color, Color::BLACK);
+        } else {
+          display.display::Display::draw_alpha_bitmap_at(4, 4, 16, 24, data.data(), bpp, color, Color::BLACK);
+        }
+      }
+      auto elapsed = std::chrono::steady_clock::now() - start;
+      times[current] = std::chrono::duration<double, std::micro>(elapsed).count() / (rounds * 10);
+    }
+    printf("%-16s 16x24 glyph at %d bpp, clipped runs %6.2f us, driver %6.2f us\n", name, bpp, times[0], times[1]);
+  }
+}
+
+}  // namespace benchmark
+}  // namespace esphome
+
+using namespace esphome;
+using namespace esphome::benchmark;
+
+int main(int argc, char **argv) {
+  int rectangles = argc > 1 ? atoi(argv[1]) : 2000;
+  int rounds = argc > 2 ? atoi(argv[2]) : 200;
+
+  // a landscape panel, so that rotations which swap width and height show up
+  HostILI9XXX ili16_fast(320, 240, ili9xxx::BITS_16), ili16_slow(320, 240, ili9xxx::BITS_16);
+  HostILI9XXX ili8_fast(320, 240, ili9xxx::BITS_8), ili8_slow(320, 240, ili9xxx::BITS_8);
+  // 64 rows high, so rectangles start and end in the middle of the 8-pixel pages
+  HostSSD1306 ssd_fast(ssd1306_base::SSD1306_MODEL_128_64), ssd_slow(ssd1306_base::SSD1306_MODEL_128_64);
+  HostST7789V st16_fast(240, 135, false), st16_slow(240, 135, false);
+  HostST7789V st8_fast(240, 135, true), st8_slow(240, 135, true);
+  HostST7735 st7735_fast(160, 128, false), st7735_slow(160, 128, false);
+  if (!check_rectangles("ILI9XXX 16 bit", ili16_fast, ili16_slow, rectangles) ||
+      !check_rectangles("ILI9XXX 8 bit", ili8_fast, ili8_slow, rectangles) ||
+      !check_rectangles("SSD1306 128x64", ssd_fast, ssd_slow, rectangles) ||
+      !check_rectangles("ST7789V 16 bit", st16_fast, st16_slow, rectangles) ||
+      !check_rectangles("ST7789V 8 bit", st8_fast, st8_slow, rectangles) ||
+      !check_rectangles("ST7735 16 bit", st7735_fast, st7735_slow, rectangles))
+    return 1;
+  printf("%d rectangles per rotation and driver identical\n", rectangles);
+  if (!check_alpha_bitmaps("ILI9XXX 16 bit", ili16_fast, ili16_slow, rectangles) ||
+      !check_alpha_bitmaps("ILI9XXX 8 bit", ili8_fast, ili8_slow, rectangles) ||
+      !check_alpha_bitmaps("SSD1306 128x64", ssd_fast, ssd_slow, rectangles) ||
+      !check_alpha_bitmaps("ST7789V 16 bit", st16_fast, st16_slow, rectangles) ||
+      !check_alpha_bitmaps("ST7789V 8 bit", st8_fast, st8_slow, rectangles) ||
+      !check_alpha_bitmaps("ST7735 16 bit", st7735_fast, st7735_slow, rectangles))
+    return 1;
+  printf("%d alpha bitmaps per rotation and driver identical\n", rectangles);
+
+  time_shapes("ILI9XXX 16 bit", ili16_fast, rounds);
+  time_shapes("ILI9XXX 8 bit", ili8_fast, rounds);
+  time_shapes("SSD1306 128x64", ssd_fast, rounds);
+  time_glyphs("ILI9XXX 16 bit", ili16_fast, rounds);
+  time_glyphs("ST7789V 16 bit", st16_fast, rounds);
+  time_glyphs("SSD1306 128x64", ssd_fast, rounds);
+  return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env bash
+# Builds the display rectangle fill host benchmark and runs it. Exits non-zero if fill_rect() leaves a driver's buffer
+# different from drawing the same rectangle pixel by pixel, or a driver draws an alpha bitmap differently from the
+# generic runs, in any rotation.
+#
+#   tests/benchmarks/display_fill_rect/run.sh [rectangles] [rounds]
+
+set -euo pipefail
+
+here="$(cd "$(dirname "$0")" && pwd)"
+root="$(cd "$here/../../.." && pwd)"
+out="${TMPDIR:-/tmp}/display-fill-rect-benchmark"
+
+sources=(
+  "$here/benchmark.cpp"
+  "$here/stubs/host_stubs.cpp"
+  "$root"/esphome/components/display/*.cpp
+  "$root/esphome/components/ili9xxx/ili9xxx_display.cpp"
+  "$root/esphome/components/ssd1306_base/ssd1306_base.cpp"
+  "$root/esphome/components/spi/spi.cpp"
+  "$root/esphome/components/st7735/st7735.cpp"
+  "$root/esphome/components/st7789v/st7789v.cpp"
+  "$root"/esphome/core/{application,color,component,entity_base,helpers,scheduler,string_ref,time,util}.cpp
+)
+
+"${CXX:-g++}" -std=gnu++17 -O2 -w -I"$here/stubs" -I"$here" -I"$root" "${sources[@]}" -o "$out"
+"$out" "$@"
@@ -0,0 +1,4 @@
+// The ILI9XXX driver is built against the Arduino SPI bus; the benchmark never sends anything over it.
+#pragma once
+
+class SPIClass {};
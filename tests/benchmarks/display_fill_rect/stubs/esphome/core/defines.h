@@ -0,0 +1,13 @@
+// Host configuration for the display benchmark: the Arduino SPI bus is only needed to compile the drivers.
+#pragma once
+#include "esphome/core/macros.h"
+
+#define ESPHOME_BOARD "host"
+#define ESPHOME_VARIANT "host"
+#define ESPHOME_LOG_LEVEL ESPHOME_LOG_LEVEL_NONE
+#ifndef USE_HOST
+#define USE_HOST
+#endif
+#define USE_ARDUINO
+#define USE_ESPHOME_HOST_MAC_ADDRESS \
+  { 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc }
@@ -0,0 +1,107 @@
+// Compares the tiled LVGL rotation kernels against the per-pixel loops they replaced, for every rotation and a range
+// of area sizes including ones that are not a multiple of the tile size, then times both on typical flush areas.
+// Run through run.sh.
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "esphome/components/lvgl/lvgl_rotate.h"
+
+namespace esphome {
+namespace benchmark {
+
+using pixel_t = uint16_t;  // LV_COLOR_DEPTH 16
+
+// The loops LvglComponent::draw_buffer_() used before, walking the source sequentially.
+static void reference_90(const pixel_t *ptr, pixel_t *dst, int width, int height) {
+  for (int x = height; x-- != 0;) {
+    for (int y = 0; y != width; y++) {
+      dst[y * height + x] = *ptr++;
+    }
+  }
+}
+static void reference_180(const pixel_t *ptr, pixel_t *dst, int width, int height) {
+  for (int y = height; y-- != 0;) {
+    for (int x = width; x-- != 0;) {
+      dst[y * width + x] = *ptr++;
+    }
+  }
+}
+static void reference_270(const pixel_t *ptr, pixel_t *dst, int width, int height) {
+  for (int x = 0; x != height; x++) {
+    for (int y = width; y-- != 0;) {
+      dst[y * height + x] = *ptr++;
+    }
+  }
+}
+
+using rotate_t = void (*)(const pixel_t *, pixel_t *, int, int);
+
+struct Rotation {
+  int degrees;
+  rotate_t reference;
+  rotate_t current;
+};
+
+static const Rotation ROTATIONS[] = {
+    {90, reference_90, lvgl::rotate_90<pixel_t>},
+    {180, reference_180, lvgl::rotate_180<pixel_t>},
+    {270, reference_270, lvgl::rotate_270<pixel_t>},
+};
+
+static std::vector<pixel_t> pattern(int width, int height) {
+  std::vector<pixel_t> src(static_cast<size_t>(width) * height);
+  for (size_t i = 0; i < src.size(); i++)
+    src[i] = static_cast<pixel_t>(i * 2654435761u >> 7);
+  return src;
+}
+
+static double time_rotation(rotate_t rotate, int width, int height, int rounds) {
+  std::vector<pixel_t> src = pattern(width, height);
+  std::vector<pixel_t> dst(src.size());
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++)
+    rotate(src.data(), dst.data(), width, height);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::micro>(elapsed).count() / rounds;
+}
+
+}  // namespace benchmark
+}  // namespace esphome
+
+using namespace esphome::benchmark;
+
+int main(int argc, char **argv) {
+  int rounds = argc > 1 ? atoi(argv[1]) : 200;
+
+  int checked = 0;
+  for (const Rotation &rotation : ROTATIONS) {
+    for (int width = 1; width <= 70; width += 3) {
+      for (int height = 1; height <= 70; height += 5) {
+        std::vector<pixel_t> src = pattern(width, height);
+        std::vector<pixel_t> expected(src.size()), actual(src.size());
+        rotation.reference(src.data(), expected.data(), width, height);
+        rotation.current(src.data(), actual.data(), width, height);
+        if (expected != actual) {
+          fprintf(stderr, "rotation by %d degrees differs for a %dx%d area\n", rotation.degrees, width, height);
+          return 1;
+        }
+        checked++;
+      }
+    }
+  }
+  printf("%d areas identical\n", checked);
+
+  // a full 320x240 frame, and a 10% buffer of an 800x480 panel
+  const int sizes[][2] = {{320, 240}, {800, 48}};
+  for (const auto &size : sizes) {
+    for (const Rotation &rotation : ROTATIONS) {
+      printf("%dx%d by %3d degrees: reference %7.1f us, current %7.1f us\n", size[0], size[1], rotation.degrees,
+             time_rotation(rotation.reference, size[0], size[1], rounds),
+             time_rotation(rotation.current, size[0], size[1], rounds));
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,14 @@
+#!/usr/bin/env bash
+# Builds the LVGL rotation host benchmark and runs it. Exits non-zero if a tiled rotation does not produce the same
+# pixels as the per-pixel loops it replaced.
+#
+#   tests/benchmarks/lvgl_rotation/run.sh [rounds]
+
+set -euo pipefail
+
+here="$(cd "$(dirname "$0")" && pwd)"
+root="$(cd "$here/../../.." && pwd)"
+out="${TMPDIR:-/tmp}/lvgl-rotation-benchmark"
+
+"${CXX:-g++}" -std=gnu++17 -O2 -I"$root" "$here/benchmark.cpp" -o "$out"
+"$out" "$@"
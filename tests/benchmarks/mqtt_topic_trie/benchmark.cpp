@@ -0,0 +1,167 @@
+// Checks MQTTTopicTrie against the frozen recursive topic_match on randomized filters and topics, then times both on
+// a synthetic node with 153 subscriptions. Run through run.sh.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "esphome/components/mqtt/mqtt_topic_trie.h"
+#include "reference_topic_match.h"
+
+namespace esphome {
+namespace benchmark {
+
+// Subscriptions matching topic in subscription order, the way on_message used to find them.
+static void reference_match(const std::vector<std::string> &filters, const std::string &topic,
+                            std::vector<size_t> &out) {
+  out.clear();
+  for (size_t i = 0; i < filters.size(); i++) {
+    if (mqtt_reference::topic_match(topic.c_str(), filters[i].c_str()))
+      out.push_back(i);
+  }
+}
+
+// Subscriptions matching topic in subscription order, the way on_message finds them now.
+static void trie_match(const mqtt::MQTTTopicTrie &trie, const std::string &topic, std::vector<size_t> &out) {
+  out.clear();
+  trie.match(topic, out);
+  std::sort(out.begin(), out.end());
+}
+
+static std::string join(const std::vector<std::string> &levels) {
+  std::string ret;
+  for (size_t i = 0; i < levels.size(); i++) {
+    if (i != 0)
+      ret += '/';
+    ret += levels[i];
+  }
+  return ret;
+}
+
+// Random topics and filters over a small set of levels, so that they collide often. Covers empty levels, leading and
+// trailing separators, '$' topics and wildcards in every position.
+static std::string random_topic(std::mt19937 &rng, bool filter) {
+  static const char *const LEVELS[] = {"a", "b", "ab", "", "$SYS", "$", "state", "command"};
+  std::vector<std::string> levels(1 + rng() % 4);
+  for (auto &level : levels) {
+    unsigned pick = rng() % (filter ? 10 : 8);
+    level = pick < 8 ? LEVELS[pick] : "+";
+  }
+  if (filter && rng() % 4 == 0)
+    levels.push_back("#");
+  std::string topic = join(levels);
+  // the broker never delivers an empty topic
+  return topic.empty() ? "a" : topic;
+}
+
+struct Node {
+  std::vector<std::string> filters;
+  std::vector<std::string> topics;
+};
+
+// A node with 50 entities, each subscribed to three command topics, plus Home Assistant's birth message and two
+// wildcard subscriptions from lambdas. Half of the dispatched topics hit a subscription, the other half are the
+// node's own state topics echoed back by a catch-all subscription on the broker side.
+static Node synthetic_node() {
+  static const char *const DOMAINS[] = {"light", "switch", "fan", "cover", "number"};
+  Node node;
+  node.filters.emplace_back("homeassistant/status");
+  node.filters.emplace_back("livingroom/+/+/set");
+  node.filters.emplace_back("livingroom/debug/#");
+  for (int i = 0; i < 50; i++) {
+    std::string base = std::string("livingroom/") + DOMAINS[i % 5] + "/entity_" + std::to_string(i);
+    node.filters.push_back(base + "/command");
+    node.filters.push_back(base + "/speed/command");
+    node.filters.push_back(base + "/oscillation/command");
+    node.topics.push_back(base + "/command");
+    node.topics.push_back(base + "/state");
+  }
+  node.topics.emplace_back("homeassistant/status");
+  node.topics.emplace_back("livingroom/debug/heap");
+  return node;
+}
+
+}  // namespace benchmark
+}  // namespace esphome
+
+using namespace esphome;
+using namespace esphome::benchmark;
+
+int main(int argc, char **argv) {
+  int random_topics = argc > 1 ? atoi(argv[1]) : 200000;
+  int rounds = argc > 2 ? atoi(argv[2]) : 2000;
+
+  std::mt19937 rng(1);
+  std::vector<size_t> expected, actual;
+  int matches = 0;
+  for (int i = 0; i < random_topics; i++) {
+    // duplicate filters are allowed, like repeated subscribe() calls
+    std::vector<std::string> filters(1 + rng() % 12);
+    for (auto &filter : filters)
+      filter = random_topic(rng, true);
+    mqtt::MQTTTopicTrie trie;
+    for (size_t f = 0; f < filters.size(); f++)
+      trie.insert(filters[f], f);
+
+    std::string topic = random_topic(rng, false);
+    reference_match(filters, topic, expected);
+    trie_match(trie, topic, actual);
+    if (expected != actual) {
+      fprintf(stderr, "topic \"%s\" matched %zu subscriptions, expected %zu:\n", topic.c_str(), actual.size(),
+              expected.size());
+      for (size_t f = 0; f < filters.size(); f++) {
+        bool want = std::find(expected.begin(), expected.end(), f) != expected.end();
+        bool got = std::find(actual.begin(), actual.end(), f) != actual.end();
+        fprintf(stderr, "  %-20s expected %d, got %d\n", filters[f].c_str(), want, got);
+      }
+      return 1;
+    }
+    matches += expected.size();
+  }
+  printf("%d random topics identical, %d matches\n", random_topics, matches);
+
+  Node node = synthetic_node();
+  mqtt::MQTTTopicTrie trie;
+  for (size_t f = 0; f < node.filters.size(); f++)
+    trie.insert(node.filters[f], f);
+  for (const auto &topic : node.topics) {
+    reference_match(node.filters, topic, expected);
+    trie_match(trie, topic, actual);
+    if (expected != actual) {
+      fprintf(stderr, "topic \"%s\" differs on the synthetic node\n", topic.c_str());
+      return 1;
+    }
+  }
+
+  size_t checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; round++) {
+    for (const auto &topic : node.topics) {
+      reference_match(node.filters, topic, expected);
+      checksum += expected.size();
+    }
+  }
+  auto reference_time = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; round++) {
+    for (const auto &topic : node.topics) {
+      trie_match(trie, topic, actual);
+      checksum -= actual.size();
+    }
+  }
+  auto trie_time = std::chrono::steady_clock::now() - start;
+  if (checksum != 0) {
+    fprintf(stderr, "match counts differ while timing\n");
+    return 1;
+  }
+
+  double messages = static_cast<double>(rounds) * node.topics.size();
+  printf("%zu subscriptions, %zu topics: topic_match %.3f us/message, trie %.3f us/message\n", node.filters.size(),
+         node.topics.size(), std::chrono::duration<double, std::micro>(reference_time).count() / messages,
+         std::chrono::duration<double, std::micro>(trie_time).count() / messages);
+  return 0;
+}
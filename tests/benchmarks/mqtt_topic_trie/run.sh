@@ -0,0 +1,19 @@
+#!/usr/bin/env bash
+# Builds the MQTT topic trie host benchmark and runs it. Exits non-zero if the trie selects different subscriptions
+# than the recursive topic_match it replaced.
+#
+#   tests/benchmarks/mqtt_topic_trie/run.sh [random topics] [rounds]
+
+set -euo pipefail
+
+here="$(cd "$(dirname "$0")" && pwd)"
+root="$(cd "$here/../../.." && pwd)"
+out="${TMPDIR:-/tmp}/mqtt-topic-trie-benchmark"
+
+sources=(
+  "$here/benchmark.cpp"
+  "$root/esphome/components/mqtt/mqtt_topic_trie.cpp"
+)
+
+"${CXX:-g++}" -std=gnu++17 -O2 -w -I"$here/stubs" -I"$here" -I"$root" "${sources[@]}" -o "$out"
+"$out" "$@"
@@ -0,0 +1,4 @@
+// Host configuration for the MQTT topic trie benchmark.
+#pragma once
+
+#define USE_MQTT
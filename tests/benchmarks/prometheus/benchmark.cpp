@@ -0,0 +1,214 @@
+// Renders one /metrics scrape through the frozen reference renderer and the current PrometheusHandler, fails if
+// the output differs by a single byte, then times both. Run through run.sh.
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "esphome/components/binary_sensor/binary_sensor.h"
+#include "esphome/components/cover/cover.h"
+#include "esphome/components/fan/fan.h"
+#include "esphome/components/light/light_output.h"
+#include "esphome/components/light/light_state.h"
+#include "esphome/components/lock/lock.h"
+#include "esphome/components/number/number.h"
+#include "esphome/components/prometheus/prometheus_handler.h"
+#include "esphome/components/select/select.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/components/switch/switch.h"
+#include "esphome/components/text_sensor/text_sensor.h"
+#include "esphome/core/application.h"
+#include "esphome/core/preferences.h"
+#include "reference_handler.h"
+
+namespace esphome {
+
+ESPPreferences *global_preferences = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+namespace web_server_base {
+void WebServerBase::add_handler(AsyncWebHandler *handler) {}
+float WebServerBase::get_setup_priority() const { return 0.0f; }
+}  // namespace web_server_base
+
+namespace benchmark {
+
+class BenchSwitch : public switch_::Switch {
+ protected:
+  void write_state(bool state) override { this->publish_state(state); }
+};
+
+class BenchLock : public lock::Lock {
+ protected:
+  void control(const lock::LockCall &call) override {}
+};
+
+class BenchNumber : public number::Number {
+ protected:
+  void control(float value) override {}
+};
+
+class BenchSelect : public select::Select {
+ protected:
+  void control(const std::string &value) override {}
+};
+
+class BenchCover : public cover::Cover {
+ public:
+  cover::CoverTraits get_traits() override {
+    cover::CoverTraits traits;
+    traits.set_supports_position(true);
+    traits.set_supports_tilt(true);
+    return traits;
+  }
+
+ protected:
+  void control(const cover::CoverCall &call) override {}
+};
+
+class BenchFan : public fan::Fan {
+ public:
+  fan::FanTraits get_traits() override { return fan::FanTraits(true, true, false, 3); }
+
+ protected:
+  void control(const fan::FanCall &call) override {}
+};
+
+class BenchLightOutput : public light::LightOutput {
+ public:
+  light::LightTraits get_traits() override {
+    light::LightTraits traits;
+    traits.set_supported_color_modes({light::ColorMode::RGB_WHITE});
+    return traits;
+  }
+  void write_state(light::LightState *state) override {}
+};
+
+// Values that exercise every formatting branch: NaN, signed zero, rounding ties, Arduino's "ovf" range and inf.
+static const float VALUES[] = {NAN,      0.0f,          -0.0f,     1.005f,    0.125f,        -12.345f,
+                               21.5f,    1e6f,          3.4e38f,   -3.4e38f,  4294967296.0f, INFINITY,
+                               -INFINITY, 1.0f / 3.0f, 999.995f, 12345.6789f};
+
+template<typename T> static T *named(T *obj, const char *name, bool internal = false) {
+  obj->set_name(name);
+  // EntityBase keeps the pointers, so the strings live as long as the entities do.
+  obj->set_object_id((new std::string(str_snake_case(str_sanitize(name))))->c_str());
+  obj->set_internal(internal);
+  return obj;
+}
+
+static void populate(int sensors) {
+  App.pre_setup("livingroomdevice", "Living Room Device", "Living Room", "", "", false);
+  for (int i = 0; i < sensors; i++) {
+    std::string *name = new std::string("Sensor " + std::to_string(i));
+    auto *obj = named(new sensor::Sensor(), name->c_str(), i == 3);
+    obj->set_unit_of_measurement(i % 2 ? "°C" : "");
+    obj->set_accuracy_decimals(static_cast<int8_t>(i % 5 - 2));
+    obj->publish_state(VALUES[i % 16]);
+    App.register_sensor(obj);
+  }
+
+  auto *door = named(new binary_sensor::BinarySensor(), "Door");
+  door->publish_state(true);
+  App.register_binary_sensor(door);
+  App.register_binary_sensor(named(new binary_sensor::BinarySensor(), "Window"));
+
+  auto *relay = named(new BenchSwitch(), "Relay");
+  relay->publish_state(true);
+  App.register_switch(relay);
+
+  auto *status = named(new text_sensor::TextSensor(), "Status");
+  status->publish_state("ok \"quoted\"");
+  App.register_text_sensor(status);
+  App.register_text_sensor(named(new text_sensor::TextSensor(), "Empty"));
+
+  for (float value : VALUES) {
+    auto *number = named(new BenchNumber(), "Setpoint");
+    number->publish_state(value);
+    App.register_number(number);
+  }
+
+  auto *mode = named(new BenchSelect(), "Mode");
+  mode->traits.set_options({"a", "b"});
+  mode->publish_state("b");
+  App.register_select(mode);
+
+  auto *lock = named(new BenchLock(), "Front Lock");
+  lock->publish_state(lock::LOCK_STATE_LOCKED);
+  App.register_lock(lock);
+
+  for (float value : VALUES) {
+    auto *blind = named(new BenchCover(), "Blind");
+    blind->position = value;
+    blind->tilt = 1.0f - value;
+    App.register_cover(blind);
+  }
+
+  auto *fan = named(new BenchFan(), "Fan");
+  fan->state = true;
+  fan->speed = 2;
+  App.register_fan(fan);
+
+  App.register_light(named(new light::LightState(new BenchLightOutput()), "Lamp"));
+}
+
+static std::string render(AsyncWebHandler *handler, size_t *writes) {
+  AsyncWebServerRequest request;
+  handler->handleRequest(&request);
+  *writes = request.sent->writes;
+  return request.sent->content;
+}
+
+static double time_scrape(AsyncWebHandler *handler, int rounds) {
+  size_t writes;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++)
+    render(handler, &writes);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::micro>(elapsed).count() / rounds;
+}
+
+}  // namespace benchmark
+}  // namespace esphome
+
+using namespace esphome;
+
+int main(int argc, char **argv) {
+  int sensors = argc > 1 ? atoi(argv[1]) : 100;
+  int rounds = argc > 2 ? atoi(argv[2]) : 200;
+  benchmark::populate(sensors);
+
+  auto *base = new web_server_base::WebServerBase();
+  prometheus_reference::PrometheusHandler reference(base);
+  prometheus::PrometheusHandler current(base);
+  for (auto *obj : App.get_switches()) {
+    reference.add_label_id(obj, "relay_custom");
+    current.add_label_id(obj, "relay_custom");
+  }
+  for (auto *obj : App.get_text_sensors()) {
+    reference.add_label_name(obj, "Custom Status");
+    current.add_label_name(obj, "Custom Status");
+  }
+  current.setup();
+
+  size_t reference_writes, current_writes;
+  std::string expected = benchmark::render(&reference, &reference_writes);
+  std::string actual = benchmark::render(&current, &current_writes);
+  if (expected != actual) {
+    size_t pos = 0;
+    while (pos < expected.size() && pos < actual.size() && expected[pos] == actual[pos])
+      pos++;
+    size_t line = expected.rfind('\n', pos);
+    line = line == std::string::npos ? 0 : line + 1;
+    fprintf(stderr, "output differs at byte %zu\nexpected: %.120s\nactual:   %.120s\n", pos, expected.c_str() + line,
+            actual.c_str() + std::min(line, actual.size()));
+    return 1;
+  }
+
+  printf("%zu bytes, identical; reference %zu writes, current %zu writes\n", expected.size(), reference_writes,
+         current_writes);
+  printf("reference: %.1f us per scrape\n", benchmark::time_scrape(&reference, rounds));
+  printf("current:   %.1f us per scrape\n", benchmark::time_scrape(&current, rounds));
+  return 0;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env bash
+# Builds the Prometheus host benchmark and runs it. Exits non-zero if the current handler's /metrics output is not
+# byte-for-byte identical to the reference renderer.
+#
+#   tests/benchmarks/prometheus/run.sh [sensor count] [rounds]
+
+set -euo pipefail
+
+here="$(cd "$(dirname "$0")" && pwd)"
+root="$(cd "$here/../../.." && pwd)"
+out="${TMPDIR:-/tmp}/prometheus-benchmark"
+
+sources=(
+  "$here/benchmark.cpp"
+  "$here/reference_handler.cpp"
+  "$here/stubs/host_stubs.cpp"
+  "$root/esphome/components/prometheus/prometheus_handler.cpp"
+  "$root"/esphome/core/{application,color,component,entity_base,helpers,scheduler,string_ref,time,util}.cpp
+)
+for component in binary_sensor cover fan light lock number select sensor switch text_sensor; do
+  sources+=("$root"/esphome/components/"$component"/*.cpp)
+done
+
+cd "$root"
+"${CXX:-g++}" -std=gnu++17 -O2 -w -I"$here/stubs" -I"$here" -I"$root" "${sources[@]}" -o "$out"
+"$out" "$@"
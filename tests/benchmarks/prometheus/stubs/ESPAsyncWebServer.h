@@ -0,0 +1,143 @@
+// Host stand-in for the parts of ESPAsyncWebServer the Prometheus handler touches. Print mirrors the ESP32 Arduino
+// core (printNumber/printFloat) so the reference renderer produces the same bytes it does on a device, and
+// AsyncResponseStream counts write() calls so the benchmark can report how many chunks a scrape took.
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+using String = std::string;
+
+class Print {
+ public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--)
+      n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char *s) { return write(reinterpret_cast<const uint8_t *>(s), strlen(s)); }
+  virtual void flush() {}
+
+  size_t print(const __FlashStringHelper *s) { return write(reinterpret_cast<const char *>(s)); }
+  size_t print(const char *s) { return write(s); }
+  size_t print(char c) { return write(static_cast<uint8_t>(c)); }
+  size_t print(unsigned char b, int base = 10) { return print(static_cast<unsigned long>(b), base); }
+  size_t print(int n, int base = 10) { return print(static_cast<long>(n), base); }
+  size_t print(unsigned int n, int base = 10) { return print(static_cast<unsigned long>(n), base); }
+  size_t print(long n, int base = 10) {
+    if (n < 0)
+      return print('-') + print_number_(-n, base);
+    return print_number_(n, base);
+  }
+  size_t print(unsigned long n, int base = 10) { return print_number_(n, base); }
+  size_t print(double number, int digits = 2) { return print_float_(number, digits); }
+
+ private:
+  size_t print_number_(unsigned long n, uint8_t base) {
+    char buf[8 * sizeof(long) + 1];
+    char *str = &buf[sizeof(buf) - 1];
+    *str = '\0';
+    do {
+      unsigned long m = n;
+      n /= base;
+      char c = m - base * n;
+      *--str = c < 10 ? c + '0' : c + 'A' - 10;
+    } while (n);
+    return write(str);
+  }
+  size_t print_float_(double number, uint8_t digits) {
+    if (std::isnan(number))
+      return print("nan");
+    if (std::isinf(number))
+      return print("inf");
+    if (number > 4294967040.0 || number < -4294967040.0)
+      return print("ovf");
+    size_t n = 0;
+    if (number < 0.0) {
+      n += print('-');
+      number = -number;
+    }
+    double rounding = 0.5;
+    for (uint8_t i = 0; i < digits; ++i)
+      rounding /= 10.0;
+    number += rounding;
+    unsigned long int_part = static_cast<unsigned long>(number);
+    double remainder = number - static_cast<double>(int_part);
+    n += print(int_part);
+    if (digits > 0)
+      n += print(".");
+    while (digits-- > 0) {
+      remainder *= 10.0;
+      int to_print = static_cast<int>(remainder);
+      n += print(to_print);
+      remainder -= to_print;
+    }
+    return n;
+  }
+};
+
+enum WebRequestMethod { HTTP_GET = 1, HTTP_POST = 2 };
+
+class AsyncResponseStream : public Print {
+ public:
+  using Print::write;
+  size_t write(uint8_t c) override {
+    this->content.push_back(static_cast<char>(c));
+    this->writes++;
+    return 1;
+  }
+  size_t write(const uint8_t *data, size_t len) override {
+    this->content.append(reinterpret_cast<const char *>(data), len);
+    this->writes++;
+    return len;
+  }
+
+  std::string content;
+  size_t writes{0};
+};
+
+class AsyncWebServerRequest {
+ public:
+  int method() const { return HTTP_GET; }
+  std::string url() const { return "/metrics"; }
+  bool authenticate(const char *username, const char *password) { return true; }
+  void requestAuthentication() {}
+  AsyncResponseStream *beginResponseStream(const char *content_type) { return new AsyncResponseStream(); }
+  void send(AsyncResponseStream *stream) { this->sent.reset(stream); }
+
+  std::unique_ptr<AsyncResponseStream> sent;
+};
+
+class AsyncWebHandler {
+ public:
+  virtual ~AsyncWebHandler() = default;
+  virtual bool canHandle(AsyncWebServerRequest *request) { return false; }
+  virtual void handleRequest(AsyncWebServerRequest *request) {}
+  virtual void handleUpload(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data,
+                            size_t len, bool final) {}
+  virtual void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {}
+  virtual bool isRequestHandlerTrivial() { return true; }
+};
+
+class AsyncWebServer {
+ public:
+  AsyncWebServer(uint16_t port) {}
+  void addHandler(AsyncWebHandler *handler) {}
+  void begin() {}
+};
+
+class DefaultHeaders {
+ public:
+  static DefaultHeaders &Instance() {
+    static DefaultHeaders headers;
+    return headers;
+  }
+  void addHeader(const char *name, const char *value) {}
+};
@@ -0,0 +1,25 @@
+// Host configuration for the Prometheus benchmark: Arduino-style web server with every exported entity domain.
+#pragma once
+#include "esphome/core/macros.h"
+
+#define ESPHOME_BOARD "host"
+#define ESPHOME_VARIANT "host"
+#define ESPHOME_LOG_LEVEL ESPHOME_LOG_LEVEL_NONE
+#ifndef USE_HOST
+#define USE_HOST
+#endif
+#define USE_ARDUINO
+#define USE_NETWORK
+#define USE_ESPHOME_HOST_MAC_ADDRESS \
+  { 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc }
+
+#define USE_BINARY_SENSOR
+#define USE_COVER
+#define USE_FAN
+#define USE_LIGHT
+#define USE_LOCK
+#define USE_NUMBER
+#define USE_SELECT
+#define USE_SENSOR
+#define USE_SWITCH
+#define USE_TEXT_SENSOR
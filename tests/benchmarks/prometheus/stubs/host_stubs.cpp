@@ -0,0 +1,25 @@
+// Minimal HAL for linking the core and entity components into a plain host executable.
+#include <chrono>
+#include <cstdint>
+
+namespace esphome {
+
+static const auto START = std::chrono::steady_clock::now();
+
+uint32_t millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - START).count();
+}
+uint32_t micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - START).count();
+}
+void delay(uint32_t ms) {}
+void delayMicroseconds(uint32_t us) {}
+void yield() {}
+void arch_feed_wdt() {}
+void arch_restart() {}
+void arch_init() {}
+uint32_t arch_get_cpu_cycle_count() { return 0; }
+uint32_t arch_get_cpu_freq_hz() { return 1; }
+uint8_t progmem_read_byte(const uint8_t *addr) { return *addr; }
+
+}  // namespace esphome
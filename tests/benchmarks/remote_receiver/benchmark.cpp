@@ -0,0 +1,332 @@
+// Replays edge sequences through the ESP8266/LibreTiny remote_receiver interrupt handler and loop(), with loop()
+// running at random points between edges like it does on a device. Checks that every frame is decoded to the
+// timings that were sent: with escaped long durations, frames queued back to back, spurious interrupts and a clock
+// that wraps. A frame must be decoded as soon as the next one starts, and after a buffer overflow the rest of the
+// frame must be dropped and the receiver resync on the next frame start. Then times the interrupt handler and the
+// decoding. Run through run.sh.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "esphome/components/remote_receiver/remote_receiver.h"
+#include "host_stubs.h"
+
+namespace esphome {
+namespace benchmark {
+
+using remote_base::RawTimings;
+using remote_receiver::RemoteReceiverComponentStore;
+
+class ReplayPin : public InternalGPIOPin {
+ public:
+  void setup() override {}
+  void pin_mode(gpio::Flags flags) override {}
+  gpio::Flags get_flags() const override { return gpio::FLAG_INPUT; }
+  bool digital_read() override { return replay::pin_level; }
+  void digital_write(bool value) override {}
+  std::string dump_summary() const override { return "replay"; }
+  void detach_interrupt() const override {}
+  ISRInternalGPIOPin to_isr() const override { return ISRInternalGPIOPin(); }
+  uint8_t get_pin() const override { return 0; }
+  bool is_inverted() const override { return false; }
+
+ protected:
+  void attach_interrupt(void (*func)(void *), void *arg, gpio::InterruptType type) const override {}
+};
+
+class Capture : public remote_base::RemoteReceiverListener {
+ public:
+  bool on_receive(remote_base::RemoteReceiveData data) override {
+    this->frames.push_back(data.get_raw_data());
+    return true;
+  }
+  std::vector<RawTimings> frames;
+};
+
+class ReplayReceiver : public remote_receiver::RemoteReceiverComponent {
+ public:
+  ReplayReceiver(ReplayPin *pin, uint32_t buffer_size, uint32_t idle_us, Capture *capture)
+      : RemoteReceiverComponent(pin) {
+    this->set_buffer_size(buffer_size);
+    this->set_filter_us(10);
+    this->set_idle_us(idle_us);
+    this->register_listener(capture);
+    this->setup();
+  }
+  ~ReplayReceiver() { delete[] this->store_.buffer; }
+
+  /// Run the interrupt handler for the pin changing to level at the given time.
+  void edge(uint32_t at, bool level) {
+    replay::now_us = at;
+    replay::pin_level = level;
+    RemoteReceiverComponentStore::gpio_intr(&this->store_);
+  }
+  void loop_at(uint32_t at) {
+    replay::now_us = at;
+    this->loop();
+  }
+  uint32_t overflow_count() const { return this->store_.overflow_count; }
+};
+
+/// A frame as sent: the level of its first edge and the time to each following edge.
+struct Frame {
+  bool level;
+  std::vector<uint32_t> durations;
+
+  /// The timings loop() reports for the frame: marks positive, spaces negative, ending with the idle time.
+  RawTimings expected(uint32_t idle_us) const {
+    RawTimings ret;
+    int32_t sign = this->level ? 1 : -1;
+    for (uint32_t duration : this->durations) {
+      ret.push_back(sign * int32_t(duration));
+      sign = -sign;
+    }
+    ret.push_back(sign * int32_t(idle_us));
+    return ret;
+  }
+};
+
+static std::string to_string(const RawTimings &timings) {
+  std::string ret;
+  for (int32_t timing : timings)
+    ret += " " + std::to_string(timing);
+  return ret;
+}
+
+/// Sends one frame after an idle gap of gap microseconds, without running loop().
+static void send(ReplayReceiver &receiver, const Frame &frame, uint32_t gap, uint32_t &now) {
+  now += gap;
+  bool level = frame.level;
+  receiver.edge(now, level);
+  for (uint32_t duration : frame.durations) {
+    now += duration;
+    level = !level;
+    receiver.edge(now, level);
+  }
+}
+
+/// Sends frames separated by idle gaps, calling loop() between edges with the given probability and once more
+/// after the last frame. Spurious interrupts that do not change the level are injected with the same probability.
+static void replay(ReplayReceiver &receiver, const std::vector<Frame> &frames, uint32_t idle_us, uint32_t &now,
+                   std::mt19937 &rng, double loop_probability) {
+  std::uniform_real_distribution<double> chance(0.0, 1.0);
+  auto maybe_loop = [&](uint32_t from, uint32_t to) {
+    if (chance(rng) < loop_probability)
+      receiver.loop_at(from + rng() % (to - from));
+    if (chance(rng) < loop_probability)
+      receiver.edge(from + rng() % (to - from), replay::pin_level);
+  };
+
+  for (const Frame &frame : frames) {
+    uint32_t gap = idle_us + rng() % (2 * idle_us);
+    maybe_loop(now, now + gap);
+    now += gap;
+    bool level = frame.level;
+    receiver.edge(now, level);
+    for (uint32_t duration : frame.durations) {
+      maybe_loop(now, now + duration);
+      now += duration;
+      level = !level;
+      receiver.edge(now, level);
+    }
+  }
+  now += idle_us;
+  receiver.loop_at(now);
+}
+
+/// A random frame starting by changing the pin from level, with durations above the filter and below idle_us.
+static Frame random_frame(std::mt19937 &rng, bool level, uint32_t idle_us, size_t max_edges) {
+  Frame frame{!level, {}};
+  size_t edges = 1 + rng() % max_edges;
+  for (size_t i = 0; i < edges; i++) {
+    switch (rng() % 4) {
+      case 0:
+        frame.durations.push_back(11 + rng() % 100);
+        break;
+      case 1:
+        frame.durations.push_back(idle_us - 1 - rng() % 100);
+        break;
+      default:
+        frame.durations.push_back(11 + rng() % (idle_us - 11));
+        break;
+    }
+  }
+  return frame;
+}
+
+static bool check_frames(const char *scenario, const std::vector<RawTimings> &actual,
+                         const std::vector<RawTimings> &expected) {
+  if (actual == expected)
+    return true;
+  fprintf(stderr, "%s: decoded %zu frames, expected %zu\n", scenario, actual.size(), expected.size());
+  for (size_t i = 0; i < std::max(actual.size(), expected.size()); i++) {
+    std::string want = i < expected.size() ? to_string(expected[i]) : " (none)";
+    std::string got = i < actual.size() ? to_string(actual[i]) : " (none)";
+    if (want != got) {
+      fprintf(stderr, "  frame %zu\n    expected%s\n    actual  %s\n", i, want.c_str(), got.c_str());
+      break;
+    }
+  }
+  return false;
+}
+
+/// Random frames through a buffer large enough to hold all of them. Every frame must come out exactly as sent.
+static bool check_random(const char *scenario, uint32_t idle_us, size_t max_edges, double loop_probability,
+                         int runs, std::mt19937 &rng) {
+  for (int run = 0; run < runs; run++) {
+    // start close to the wrap of micros()
+    uint32_t now = 0xFFFFFFFF - rng() % (4 * idle_us);
+    replay::now_us = now;
+    replay::pin_level = rng() % 2;
+    ReplayPin pin;
+    Capture capture;
+    ReplayReceiver receiver(&pin, 4096, idle_us, &capture);
+
+    std::vector<Frame> frames;
+    std::vector<RawTimings> expected;
+    bool level = replay::pin_level;
+    for (int i = 0, count = 1 + rng() % 8; i < count; i++) {
+      frames.push_back(random_frame(rng, level, idle_us, max_edges));
+      level = frames.back().level ^ (frames.back().durations.size() % 2);
+      expected.push_back(frames.back().expected(idle_us));
+    }
+    replay(receiver, frames, idle_us, now, rng, loop_probability);
+    // loop() decodes one frame per call
+    for (size_t i = 0; i < frames.size(); i++)
+      receiver.loop_at(now);
+    if (!check_frames(scenario, capture.frames, expected) || receiver.overflow_count() != 0)
+      return false;
+  }
+  return true;
+}
+
+/// A frame must be decoded as soon as the next one starts, without waiting for the next one to go idle.
+static bool check_next_frame_start() {
+  const uint32_t idle_us = 10000;
+  uint32_t now = 1000000;
+  replay::now_us = now;
+  replay::pin_level = false;
+  ReplayPin pin;
+  Capture capture;
+  ReplayReceiver receiver(&pin, 100, idle_us, &capture);
+
+  Frame first{true, {9000, 4500, 560}};
+  Frame second{true, {2400, 600, 1200}};
+  send(receiver, first, idle_us, now);
+  send(receiver, second, idle_us, now);
+  receiver.loop_at(now);
+  if (!check_frames("next frame started", capture.frames, {first.expected(idle_us)}))
+    return false;
+  receiver.loop_at(now + idle_us);
+  return check_frames("next frame went idle", capture.frames, {first.expected(idle_us), second.expected(idle_us)});
+}
+
+/// A frame too long for the buffer, followed by short frames. The first frame must come out as a prefix of what was
+/// sent, and the frame after the overflow must come out exactly. When loop() does not run before the second frame
+/// starts, the second frame finds the buffer still full and is dropped as a whole; the third one must then be exact.
+static bool check_overflow(bool loop_between) {
+  const uint32_t idle_us = 10000;
+  uint32_t now = 1000000;
+  replay::now_us = now;
+  replay::pin_level = false;
+  ReplayPin pin;
+  Capture capture;
+  // 8 slots hold 16 entries
+  ReplayReceiver receiver(&pin, 8, idle_us, &capture);
+
+  // each frame starts by raising the pin and ends with it low
+  Frame overflowing{true, std::vector<uint32_t>(39, 560)};
+  Frame second{true, {9000, 4500, 560, 1690, 560}};
+  Frame third{true, {2400, 600, 1200, 600, 1200}};
+
+  send(receiver, overflowing, idle_us, now);
+  if (!loop_between) {
+    // the overflowing frame is still in the buffer when the second one arrives
+    send(receiver, second, idle_us, now);
+  }
+  now += idle_us;
+  receiver.loop_at(now);
+  receiver.loop_at(now);
+  if (loop_between)
+    send(receiver, second, idle_us, now);
+  send(receiver, third, idle_us, now);
+  now += idle_us;
+  for (int i = 0; i < 3; i++)
+    receiver.loop_at(now);
+
+  const char *scenario = loop_between ? "overflow, loop between frames" : "overflow, frames back to back";
+  RawTimings sent = overflowing.expected(idle_us);
+  if (capture.frames.empty() || capture.frames[0].size() >= sent.size() ||
+      !std::equal(capture.frames[0].begin(), capture.frames[0].end() - 1, sent.begin())) {
+    fprintf(stderr, "%s: the overflowing frame is not a prefix of what was sent\n", scenario);
+    return false;
+  }
+  std::vector<RawTimings> expected{capture.frames[0]};
+  if (loop_between)
+    expected.push_back(second.expected(idle_us));
+  expected.push_back(third.expected(idle_us));
+  if (!check_frames(scenario, capture.frames, expected))
+    return false;
+  if (receiver.overflow_count() == 0) {
+    fprintf(stderr, "%s: no dropped edges were counted\n", scenario);
+    return false;
+  }
+  return true;
+}
+
+}  // namespace benchmark
+}  // namespace esphome
+
+using namespace esphome;
+using namespace esphome::benchmark;
+
+int main(int argc, char **argv) {
+  int runs = argc > 1 ? atoi(argv[1]) : 2000;
+
+  std::mt19937 rng(1);
+  // loop() between most edges, between some edges, and only once all frames are in
+  for (double loop_probability : {0.9, 0.1, 0.0}) {
+    if (!check_random("short durations", 10000, 100, loop_probability, runs, rng))
+      return 1;
+    // an idle time above 32767 us makes room for durations that need the escaped two-entry form
+    if (!check_random("long durations", 500000, 20, loop_probability, runs, rng))
+      return 1;
+  }
+  if (!check_next_frame_start() || !check_overflow(true) || !check_overflow(false))
+    return 1;
+  printf("%d random replays decoded exactly, frames decoded on the next frame start, overflow resyncs\n", runs * 6);
+
+  // an NEC frame: leader, 32 bits, stop bit
+  Frame nec{true, {9000, 4500}};
+  for (int bit = 0; bit < 32; bit++) {
+    nec.durations.push_back(560);
+    nec.durations.push_back(bit % 3 == 0 ? 1690 : 560);
+  }
+  nec.durations.push_back(560);
+
+  const int frames = 20000;
+  const uint32_t idle_us = 10000;
+  replay::now_us = 0;
+  replay::pin_level = false;
+  ReplayPin pin;
+  Capture capture;
+  ReplayReceiver receiver(&pin, 1000, idle_us, &capture);
+  uint32_t now = 0;
+  std::chrono::steady_clock::duration isr{}, loop{};
+  for (int i = 0; i < frames; i++) {
+    auto start = std::chrono::steady_clock::now();
+    send(receiver, nec, 2 * idle_us, now);
+    auto middle = std::chrono::steady_clock::now();
+    receiver.loop_at(now + idle_us);
+    isr += middle - start;
+    loop += std::chrono::steady_clock::now() - middle;
+    capture.frames.clear();
+  }
+  printf("NEC frame, %zu edges: %.1f ns per interrupt, %.0f ns to decode a frame\n", nec.durations.size() + 1,
+         std::chrono::duration<double, std::nano>(isr).count() / (frames * (nec.durations.size() + 1.0)),
+         std::chrono::duration<double, std::nano>(loop).count() / frames);
+  return 0;
+}
@@ -0,0 +1,34 @@
+#!/usr/bin/env bash
+# Builds the remote_receiver replay harness and runs it. Exits non-zero if a replayed frame is not decoded to the
+# timings that were sent. The ESP8266 and LibreTiny receivers share the same interrupt handler and loop; the harness
+# builds the LibreTiny copy and first checks that the ESP8266 copy has not drifted from it.
+#
+#   tests/benchmarks/remote_receiver/run.sh [runs]
+
+set -euo pipefail
+
+here="$(cd "$(dirname "$0")" && pwd)"
+root="$(cd "$here/../../.." && pwd)"
+out="${TMPDIR:-/tmp}/remote-receiver-benchmark"
+receiver="$root/esphome/components/remote_receiver"
+
+if ! diff -u \
+  <(sed -e 's/USE_ESP8266/USE_PLATFORM/' -e 's/remote_receiver\.esp8266/remote_receiver.platform/' \
+    "$receiver/remote_receiver_esp8266.cpp") \
+  <(sed -e 's/USE_LIBRETINY/USE_PLATFORM/' -e 's/remote_receiver\.libretiny/remote_receiver.platform/' \
+    "$receiver/remote_receiver_libretiny.cpp"); then
+  echo "remote_receiver_esp8266.cpp and remote_receiver_libretiny.cpp differ" >&2
+  exit 1
+fi
+
+sources=(
+  "$here/benchmark.cpp"
+  "$here/stubs/host_stubs.cpp"
+  "$receiver/remote_receiver_libretiny.cpp"
+  "$root/esphome/components/remote_base/remote_base.cpp"
+  "$root"/esphome/components/binary_sensor/*.cpp
+  "$root"/esphome/core/{application,component,entity_base,helpers,scheduler,string_ref,time,util}.cpp
+)
+
+"${CXX:-g++}" -std=gnu++17 -O2 -w -DUSE_LIBRETINY -I"$here/stubs" -I"$here" -I"$root" "${sources[@]}" -o "$out"
+"$out" "$@"
@@ -0,0 +1,14 @@
+// Host stand-in for the LibreTiny SDK pieces the core headers and helpers.cpp reference. The replay harness runs the
+// interrupt handler and the loop on one thread, so locks and interrupt masking do nothing.
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#define pdTRUE 1
+#define portMAX_DELAY 0xFFFFFFFF
+#define portDISABLE_INTERRUPTS()
+#define portENABLE_INTERRUPTS()
+
+inline size_t lt_heap_get_free() { return 0; }
+inline void lt_rand_bytes(uint8_t *data, size_t len) { memset(data, 0, len); }
@@ -0,0 +1,11 @@
+// Host stand-in for the LibreTiny WiFi object helpers.cpp reads the MAC address from.
+#pragma once
+#include <cstdint>
+#include <cstring>
+
+class WiFiClass {
+ public:
+  uint8_t *macAddress(uint8_t *mac) { return static_cast<uint8_t *>(memset(mac, 0, 6)); }
+};
+
+static WiFiClass WiFi;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
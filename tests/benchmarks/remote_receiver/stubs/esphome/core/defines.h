@@ -0,0 +1,6 @@
+// Host configuration for the remote_receiver replay harness. run.sh defines USE_LIBRETINY, like the LibreTiny
+// platform does through its build flags, but no framework.
+#pragma once
+#include "esphome/core/macros.h"
+
+#define ESPHOME_LOG_LEVEL ESPHOME_LOG_LEVEL_NONE
@@ -0,0 +1,30 @@
+// Minimal HAL for replaying edges through remote_receiver on the host. Time and the pin level are set by the
+// harness before each simulated interrupt.
+#include <cstdint>
+
+#include "esphome/core/gpio.h"
+#include "host_stubs.h"
+
+namespace esphome {
+
+namespace replay {
+uint32_t now_us = 0;   // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+bool pin_level = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+}  // namespace replay
+
+uint32_t millis() { return replay::now_us / 1000; }
+uint32_t micros() { return replay::now_us; }
+void delay(uint32_t ms) { replay::now_us += ms * 1000; }
+void delayMicroseconds(uint32_t us) { replay::now_us += us; }
+void yield() {}
+void arch_feed_wdt() {}
+
+bool ISRInternalGPIOPin::digital_read() { return replay::pin_level; }
+
+void arch_restart() {}
+void arch_init() {}
+uint32_t arch_get_cpu_cycle_count() { return 0; }
+uint32_t arch_get_cpu_freq_hz() { return 1; }
+uint8_t progmem_read_byte(const uint8_t *addr) { return *addr; }
+
+}  // namespace esphome
@@ -0,0 +1,12 @@
+// Simulated clock and pin of the remote_receiver replay harness, see host_stubs.cpp.
+#pragma once
+#include <cstdint>
+
+namespace esphome {
+namespace replay {
+
+extern uint32_t now_us;
+extern bool pin_level;
+
+}  // namespace replay
+}  // namespace esphome
@@ -0,0 +1,8 @@
+// Host stand-in for the FreeRTOS semaphore API.
+#pragma once
+
+typedef void *SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return nullptr; }
+inline int xSemaphoreTake(SemaphoreHandle_t handle, uint32_t ticks) { return pdTRUE; }
+inline int xSemaphoreGive(SemaphoreHandle_t handle) { return pdTRUE; }